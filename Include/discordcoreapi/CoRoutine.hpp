@@ -32,7 +32,8 @@
 
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/Utilities/CoRoutineThreadPool.hpp>
-#include <discordcoreapi/Utilities/UnboundedMessageBlock.hpp>
+#include <discordcoreapi/Utilities/TimerWheel.hpp>
+#include <discordcoreapi/Utilities/MPMCQueue.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
 
 namespace DiscordCoreAPI {
@@ -66,6 +67,32 @@ namespace DiscordCoreAPI {
 
 			inline void requestStop() {
 				areWeStoppedBool.store(true);
+				std::unique_lock lock{ stopMutex };
+				std::function<void()> stopCallbackNew{ std::move(stopCallback) };
+				stopCallback = nullptr;
+				lock.unlock();
+				if (stopCallbackNew) {
+					stopCallbackNew();
+				}
+			}
+
+			/// @brief Registers a callback to be run if a stop is requested while the CoRoutine is suspended - so that whatever it is waiting on
+			/// can resume it early.
+			/// @param stopCallbackNew The callback to run.
+			/// @return False if a stop has already been requested, in which case the callback is not registered.
+			inline bool setStopCallback(std::function<void()> stopCallbackNew) {
+				std::unique_lock lock{ stopMutex };
+				if (areWeStoppedBool.load()) {
+					return false;
+				}
+				stopCallback = std::move(stopCallbackNew);
+				return true;
+			}
+
+			/// @brief Removes the registered stop callback, if any.
+			inline void clearStopCallback() {
+				std::unique_lock lock{ stopMutex };
+				stopCallback = nullptr;
 			}
 
 			inline bool areWeStopped() {
@@ -110,9 +137,11 @@ namespace DiscordCoreAPI {
 			}
 
 		  protected:
-			UnboundedMessageBlock<std::exception_ptr>* exceptionBuffer{};
-			UnboundedMessageBlock<ReturnType>* resultBuffer{};
+			MPMCQueue<std::exception_ptr>* exceptionBuffer{};
+			MPMCQueue<ReturnType>* resultBuffer{};
+			std::function<void()> stopCallback{};
 			std::atomic_bool areWeStoppedBool{};
+			std::mutex stopMutex{};
 			ReturnType result{};
 		};
 
@@ -167,15 +196,9 @@ namespace DiscordCoreAPI {
 		/// @return The final value resulting from the CoRoutine's execution.
 		inline ReturnType get() {
 			if (coroutineHandle) {
-				Milliseconds startTime{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
 				if (!coroutineHandle.done()) {
-					while (!resultBuffer.tryReceive(result)) {
-						Milliseconds now{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
-						uint64_t timeOutNew{ timeOut };
-						if (timeOutNew && (now - startTime).count() >= 15000) {
-							return std::move(result);
-						}
-						std::this_thread::sleep_for(1ms);
+					if (!waitForResult(result)) {
+						return std::move(result);
 					}
 				}
 				currentStatus.store(CoRoutineStatus::Complete);
@@ -194,23 +217,16 @@ namespace DiscordCoreAPI {
 		/// @return The final value resulting from the CoRoutine's execution.
 		inline ReturnType cancel() {
 			if (coroutineHandle) {
-				Milliseconds startTime{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
 				if (!coroutineHandle.done()) {
 					coroutineHandle.promise().requestStop();
-					while (!resultBuffer.tryReceive(result)) {
-						Milliseconds now{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
-						uint64_t timeOutNew{ timeOut };
-						if (timeOutNew && (now - startTime).count() >= 15000) {
-							return std::move(result);
-						}
-						std::this_thread::sleep_for(1ms);
+					if (!waitForResult(result)) {
+						return std::move(result);
 					}
 				}
 				currentStatus.store(CoRoutineStatus::Cancelled);
 				std::exception_ptr exception{};
 				while (exceptionBuffer.tryReceive(exception)) {
 					std::rethrow_exception(exception);
-					std::this_thread::sleep_for(1ms);
 				}
 				return std::move(result);
 			} else {
@@ -222,9 +238,20 @@ namespace DiscordCoreAPI {
 	  protected:
 		std::coroutine_handle<CoRoutine<ReturnType, timeOut>::promise_type> coroutineHandle{};
 		std::atomic<CoRoutineStatus> currentStatus{ CoRoutineStatus::Idle };
-		UnboundedMessageBlock<std::exception_ptr> exceptionBuffer{};
-		UnboundedMessageBlock<ReturnType> resultBuffer{};
+		MPMCQueue<std::exception_ptr> exceptionBuffer{ 1 };///< Carries the one exception that the CoRoutine may throw.
+		MPMCQueue<ReturnType> resultBuffer{ 1 };///< Carries the one result that the CoRoutine returns.
 		ReturnType result{};
+
+		/// @brief Parks the calling thread until the CoRoutine sends its result - or until 15 seconds have passed, if timeOut is set.
+		/// @return True if the result arrived, false if we timed out.
+		template<typename ValueType> inline bool waitForResult(ValueType& resultNew) {
+			if constexpr (timeOut) {
+				return resultBuffer.receiveFor(resultNew, 15000ms);
+			} else {
+				resultBuffer.receive(resultNew);
+				return true;
+			}
+		}
 	};
 
 	/// @brief A CoRoutine - representing a potentially asynchronous operation/function.
@@ -237,6 +264,32 @@ namespace DiscordCoreAPI {
 
 			inline void requestStop() {
 				areWeStoppedBool.store(true);
+				std::unique_lock lock{ stopMutex };
+				std::function<void()> stopCallbackNew{ std::move(stopCallback) };
+				stopCallback = nullptr;
+				lock.unlock();
+				if (stopCallbackNew) {
+					stopCallbackNew();
+				}
+			}
+
+			/// @brief Registers a callback to be run if a stop is requested while the CoRoutine is suspended - so that whatever it is waiting on
+			/// can resume it early.
+			/// @param stopCallbackNew The callback to run.
+			/// @return False if a stop has already been requested, in which case the callback is not registered.
+			inline bool setStopCallback(std::function<void()> stopCallbackNew) {
+				std::unique_lock lock{ stopMutex };
+				if (areWeStoppedBool.load()) {
+					return false;
+				}
+				stopCallback = std::move(stopCallbackNew);
+				return true;
+			}
+
+			/// @brief Removes the registered stop callback, if any.
+			inline void clearStopCallback() {
+				std::unique_lock lock{ stopMutex };
+				stopCallback = nullptr;
 			}
 
 			inline bool areWeStopped() {
@@ -275,9 +328,11 @@ namespace DiscordCoreAPI {
 			}
 
 		  protected:
-			UnboundedMessageBlock<std::exception_ptr>* exceptionBuffer{};
-			UnboundedMessageBlock<bool>* resultBuffer{};
+			MPMCQueue<std::exception_ptr>* exceptionBuffer{};
+			MPMCQueue<bool>* resultBuffer{};
+			std::function<void()> stopCallback{};
 			std::atomic_bool areWeStoppedBool{};
+			std::mutex stopMutex{};
 		};
 
 		inline CoRoutine() = default;
@@ -332,16 +387,10 @@ namespace DiscordCoreAPI {
 		/// @brief Gets the resulting value of the CoRoutine.
 		inline void get() {
 			if (coroutineHandle) {
-				Milliseconds startTime{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
 				if (!coroutineHandle.done()) {
 					bool result{};
-					while (!resultBuffer.tryReceive(result)) {
-						Milliseconds now{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
-						uint64_t timeOutNew{ timeOut };
-						if (timeOutNew && (now - startTime).count() >= 15000) {
-							return;
-						}
-						std::this_thread::sleep_for(1ms);
+					if (!waitForResult(result)) {
+						return;
 					}
 				}
 				currentStatus.store(CoRoutineStatus::Complete);
@@ -359,17 +408,11 @@ namespace DiscordCoreAPI {
 		/// @brief Cancels the currently executing CoRoutine and returns the current result.
 		inline void cancel() {
 			if (coroutineHandle) {
-				Milliseconds startTime{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
 				if (!coroutineHandle.done()) {
 					coroutineHandle.promise().requestStop();
 					bool result{};
-					while (!resultBuffer.tryReceive(result)) {
-						Milliseconds now{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
-						uint64_t timeOutNew{ timeOut };
-						if (timeOutNew && (now - startTime).count() >= 15000) {
-							return;
-						}
-						std::this_thread::sleep_for(1ms);
+					if (!waitForResult(result)) {
+						return;
 					}
 				}
 				currentStatus.store(CoRoutineStatus::Cancelled);
@@ -387,13 +430,25 @@ namespace DiscordCoreAPI {
 	  protected:
 		std::coroutine_handle<CoRoutine<ReturnType, timeOut>::promise_type> coroutineHandle{};
 		std::atomic<CoRoutineStatus> currentStatus{ CoRoutineStatus::Idle };
-		UnboundedMessageBlock<std::exception_ptr> exceptionBuffer{};
-		UnboundedMessageBlock<bool> resultBuffer{};
+		MPMCQueue<std::exception_ptr> exceptionBuffer{ 1 };///< Carries the one exception that the CoRoutine may throw.
+		MPMCQueue<bool> resultBuffer{ 1 };///< Carries the one completion signal that the CoRoutine sends.
+
+		/// @brief Parks the calling thread until the CoRoutine sends its result - or until 15 seconds have passed, if timeOut is set.
+		/// @return True if the result arrived, false if we timed out.
+		template<typename ValueType> inline bool waitForResult(ValueType& resultNew) {
+			if constexpr (timeOut) {
+				return resultBuffer.receiveFor(resultNew, 15000ms);
+			} else {
+				resultBuffer.receive(resultNew);
+				return true;
+			}
+		}
 	};
 
 	class NewThreadAwaiterBase {
 	  public:
 		inline static DiscordCoreInternal::CoRoutineThreadPool threadPool{};
+		inline static DiscordCoreInternal::TimerWheel timerWheel{};
 	};
 
 	/// @brief An awaitable that can be used to launch the CoRoutine onto a new thread - as well as return the handle for stoppping its execution.
@@ -417,5 +472,78 @@ namespace DiscordCoreAPI {
 		std::coroutine_handle<typename CoRoutine<ReturnType, timeOut>::promise_type> coroHandle{};
 	};
 
+	/// @brief An awaitable that suspends the CoRoutine for a period of time on the shared TimerWheel - without holding onto a thread while
+	/// it waits - and then resumes it on the thread pool. If a stop is requested on the CoRoutine while it waits, the timer is cancelled and the
+	/// CoRoutine is resumed straight away.
+	class TimeDelayAwaiter : public NewThreadAwaiterBase {
+	  public:
+		inline TimeDelayAwaiter(Milliseconds timeDelayNew) : timeDelay{ timeDelayNew } {};
+
+		inline bool await_ready() const {
+			return timeDelay.count() <= 0;
+		}
+
+		template<typename PromiseType> inline bool await_suspend(std::coroutine_handle<PromiseType> coroHandleNew) {
+			if constexpr (requires { coroHandleNew.promise().setStopCallback(std::function<void()>{}); }) {
+				auto delayState = std::make_shared<DelayState>();
+				clearStopCallback = [promise = &coroHandleNew.promise()]() {
+					promise->clearStopCallback();
+				};
+				if (!coroHandleNew.promise().setStopCallback([=]() {
+						delayState->wasItStopped.store(true);
+						if (NewThreadAwaiterBase::timerWheel.cancel(delayState->timerId.load())) {
+							NewThreadAwaiterBase::threadPool.submitTask(coroHandleNew);
+						}
+					})) {
+					return false;
+				}
+				uint64_t timerId{ NewThreadAwaiterBase::timerWheel.schedule(timeDelay, [=]() {
+					NewThreadAwaiterBase::threadPool.submitTask(coroHandleNew);
+				}) };
+				delayState->timerId.store(timerId);
+				return !(delayState->wasItStopped.load() && NewThreadAwaiterBase::timerWheel.cancel(timerId));
+			} else {
+				NewThreadAwaiterBase::timerWheel.schedule(timeDelay, [=]() {
+					NewThreadAwaiterBase::threadPool.submitTask(coroHandleNew);
+				});
+				return true;
+			}
+		}
+
+		inline void await_resume() {
+			if (clearStopCallback) {
+				clearStopCallback();
+			}
+		}
+
+	  protected:
+		/// @brief Shared with the stop callback - which can run on another thread at any point during await_suspend().
+		struct DelayState {
+			std::atomic_bool wasItStopped{};///< Whether the stop callback has run.
+			std::atomic_uint64_t timerId{};///< The wheel's id for the timer, once it has been scheduled.
+		};
+
+		std::function<void()> clearStopCallback{};
+		Milliseconds timeDelay{};
+	};
+
+	namespace DiscordCoreInternal {
+
+		template<typename FunctionType> inline void submitToThreadPool(FunctionType&& function) {
+			[](std::decay_t<FunctionType> functionNew) -> CoRoutine<void, false> {
+				co_await NewThreadAwaitable<void, false>();
+				functionNew();
+				co_return;
+			}(std::forward<FunctionType>(function));
+		}
+	}
+
+	/// @brief An awaitable that can be used to suspend the CoRoutine for a period of time, without blocking a thread.
+	/// @param timeDelay The amount of time to wait for.
+	/// @return TimeDelayAwaiter A TimeDelayAwaiter for suspending the current CoRoutine's execution.
+	inline TimeDelayAwaiter TimeDelayAwaitable(Milliseconds timeDelay) {
+		return TimeDelayAwaiter{ timeDelay };
+	}
+
 	/**@}*/
 };
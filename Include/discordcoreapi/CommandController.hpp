@@ -35,12 +35,32 @@
 
 namespace DiscordCoreAPI {
 
+	/// @brief Runs the Inline commands of one gateway shard in the order that they arrived, on a thread of its own.
+	class DiscordCoreAPI_Dll ShardCommandExecutor {
+	  public:
+		ShardCommandExecutor();
+
+		ShardCommandExecutor& operator=(const ShardCommandExecutor&) = delete;
+		ShardCommandExecutor(const ShardCommandExecutor&) = delete;
+
+		/// @brief Queues a command, to be run after every command that is already queued on this shard.
+		/// @param task The command to run.
+		void submit(std::function<void()> task);
+
+		~ShardCommandExecutor();
+
+	  protected:
+		UnboundedMessageBlock<std::function<void()>> tasks{};///< Unbounded, so that a burst of commands never parks the shard's gateway thread.
+		DiscordCoreInternal::ThreadWrapper thread{};
+	};
+
 	/// @brief A class for handling commands from user input.
 	class DiscordCoreAPI_Dll CommandController {
 	  public:
 		CommandController(DiscordCoreClient*);
 
 		/// @brief Registers a function to be called.
+		/// @details Each of the names is indexed, in lower case, so that dispatching a command takes a single, exact-match lookup.
 		/// @param functionNames A vector of strings to be accepted as function names.
 		/// @param baseFunction A unique_ptr to the function to be called.
 		void registerFunction(const Jsonifier::Vector<std::string>& functionNames, UniquePtr<BaseFunction> baseFunction);
@@ -49,10 +69,37 @@ namespace DiscordCoreAPI {
 		/// @return A map containing the function names as well as unique_ptrs to the functions.
 		UnorderedMap<Jsonifier::Vector<std::string>, UniquePtr<BaseFunction>>& getFunctions();
 
+		/// @brief Runs the command that the input event names, if there is one, according to its CommandExecutionPolicy.
+		/// @details This is called from the gateway shard's thread, which no policy runs the command on.
+		/// @param commandData The command's data.
+		/// @return A CoRoutine that completes once the command has been run - or handed off to its shard's or its own thread.
 		CoRoutine<void> checkForAndRunCommand(CommandData commandData);
 
+		~CommandController();
+
 	  protected:
+		struct DedicatedThread {
+			DiscordCoreInternal::ThreadWrapper thread{};
+			std::atomic_bool isItDone{};
+		};
+
+		UnorderedMap<uint64_t, UniquePtr<ShardCommandExecutor>> shardExecutors{};
+		UnorderedMap<uint64_t, UniquePtr<DedicatedThread>> dedicatedThreads{};
 		DiscordCoreClient* discordCoreClient{};
+		std::mutex dedicatedThreadMutex{};
+		std::mutex shardExecutorMutex{};
+		uint64_t currentDedicatedId{};
+
+		/// @brief Collects the executor of the shard that received a command, creating it on first use.
+		/// @param commandData The command's data - its guild selects the shard, and direct messages go to shard 0.
+		ShardCommandExecutor& getShardExecutor(const CommandData& commandData);
+
+		/// @brief Starts a thread of its own for a command, after joining the threads of any commands that have returned.
+		/// @param task The command to run.
+		void runOnDedicatedThread(std::function<void()> task);
+
+		/// @brief Runs a command's execute function, logging whatever it throws.
+		void executeCommand(BaseFunction& function, const CommandData& commandData);
 
 		UniquePtr<BaseFunction> createFunction(const std::string& functionName);
 
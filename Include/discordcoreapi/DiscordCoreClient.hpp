@@ -108,38 +108,46 @@ namespace DiscordCoreAPI {
 
 	template<typename... ArgTypes> using TimeElapsedHandler = std::function<void(ArgTypes...)>;
 
-	template<typename... ArgTypes> inline static CoRoutine<void, false> threadFunction(TimeElapsedHandler<ArgTypes...> timeElapsedHandler,
-		bool repeated, int64_t timeInterval, ArgTypes... args) {
-		auto threadHandle = co_await NewThreadAwaitable<void, false>();
-		StopWatch<std::chrono::milliseconds> stopWatch{ Milliseconds{ timeInterval } };
-		do {
-			stopWatch.resetTimer();
-			std::this_thread::sleep_for(Milliseconds{ static_cast<int64_t>(std::ceil(static_cast<double>(timeInterval) * 10.0f / 100.0f)) });
-			while (!stopWatch.hasTimePassed() && !threadHandle.promise().areWeStopped()) {
-				std::this_thread::sleep_for(1ms);
-			}
-			if (threadHandle.promise().areWeStopped()) {
-				co_return;
-			}
-			try {
-				timeElapsedHandler(args...);
-			} catch (const DCAException& error) {
-				MessagePrinter::printError<PrintMessageType::General>(error.what());
-			}
-			if (threadHandle.promise().areWeStopped()) {
-				co_return;
-			}
-			std::this_thread::sleep_for(1ms);
-		} while (repeated);
-		co_return;
-	};
-
-	template<typename... ArgTypes> inline static void executeFunctionAfterTimePeriod(TimeElapsedHandler<ArgTypes...> timeElapsedHandler,
+	/// @brief Runs a function after a delay - or on an interval - from the shared TimerWheel, handing each run off to the thread pool.
+	/// @param timeElapsedHandler The function to run.
+	/// @param timeDelay The delay before the first run, and the interval between runs if repeated is set, in milliseconds.
+	/// @param repeated Whether to keep re-running the function, until it is cancelled - a run that outlasts the interval can overlap the next.
+	/// @param blockForCompletion Whether to block until the function has run - ignored if repeated is set, as it never completes.
+	/// @param args The arguments to pass to the function.
+	/// @return An id for cancelling the function, with cancelFunctionAfterTimePeriod().
+	template<typename... ArgTypes> inline static uint64_t executeFunctionAfterTimePeriod(TimeElapsedHandler<ArgTypes...> timeElapsedHandler,
 		int64_t timeDelay, bool repeated, bool blockForCompletion, ArgTypes... args) {
-		auto newThread = threadFunction<ArgTypes...>(timeElapsedHandler, repeated, timeDelay, args...);
-		if (blockForCompletion) {
-			newThread.get();
+		std::shared_ptr<MPMCQueue<bool>> completionBuffer{};
+		if (blockForCompletion && !repeated) {
+			completionBuffer = std::make_shared<MPMCQueue<bool>>(1);
+		}
+		uint64_t timerId{ NewThreadAwaiterBase::timerWheel.schedule(
+			Milliseconds{ timeDelay },
+			[=]() {
+				DiscordCoreInternal::submitToThreadPool([=]() {
+					try {
+						timeElapsedHandler(args...);
+					} catch (const DCAException& error) {
+						MessagePrinter::printError<PrintMessageType::General>(error.what());
+					}
+					if (completionBuffer) {
+						completionBuffer->send(true);
+					}
+				});
+			},
+			Milliseconds{ repeated ? timeDelay : 0 }) };
+		if (completionBuffer) {
+			bool result{};
+			completionBuffer->receive(result);
 		}
+		return timerId;
+	}
+
+	/// @brief Cancels a function that was scheduled with executeFunctionAfterTimePeriod() - a run that has already started is left to finish.
+	/// @param timerId The id that was returned by executeFunctionAfterTimePeriod().
+	/// @return True if the function was found and cancelled.
+	inline static bool cancelFunctionAfterTimePeriod(uint64_t timerId) {
+		return NewThreadAwaiterBase::timerWheel.cancel(timerId);
 	}
 
 	/**
@@ -187,6 +195,19 @@ namespace DiscordCoreAPI {
 		/// @return ConfigManager& A reference to the ConfigManager.
 		ConfigManager& getConfigManager();
 
+		/// @brief For collecting a pointer to the on-disk audio cache.
+		/// @return AudioCache* A pointer to the AudioCache - or nullptr, if no cache directory was configured.
+		AudioCache* getAudioCache();
+
+		/// @brief For collecting the queue latency statistics of one of the REST priority lanes.
+		/// @param lane The lane to collect the statistics of.
+		/// @return RestLaneStats The time that the lane's requests have spent queued before being sent.
+		RestLaneStats getRestLaneStats(RestLane lane);
+
+		/// @brief For collecting the number of TLS handshakes that resumed a cached session, and the number that were done in full.
+		/// @return TlsHandshakeStats The handshake counts, across every REST and websocket connection.
+		static TlsHandshakeStats getTlsHandshakeStats();
+
 		/// @brief For collecting a reference to the EventManager.
 		/// @return EventManager& A reference to the EventManager.
 		EventManager& getEventManager();
@@ -218,6 +239,7 @@ namespace DiscordCoreAPI {
 		StopWatch<std::chrono::milliseconds> connectionStopWatch01{ 5000ms };
 		std::deque<CreateApplicationCommandData> commandsToRegister{};
 		UniquePtr<DiscordCoreInternal::HttpsClient> httpsClient{};
+		UniquePtr<AudioCache> audioCache{};
 #ifdef _WIN32
 		DiscordCoreInternal::WSADataWrapper theWSAData{};
 #endif
@@ -230,6 +252,8 @@ namespace DiscordCoreAPI {
 
 		void registerFunctionsInternal();
 
+		void overwriteFunctionsInternal();
+
 		GatewayBotData getGateWayBot();
 
 		bool instantiateWebSockets();
@@ -193,16 +193,34 @@ namespace DiscordCoreAPI {
 	/// @brief Data that is received as part of a Channel creation event.
 	struct DiscordCoreAPI_Dll OnChannelCreationData : public EventData<ChannelData> {
 		OnChannelCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+		/// @brief Parses the event and applies its cache updates without building it, for when nothing listens to it.
+		static void updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+	  protected:
+		static void updateCache(ChannelData& value);
 	};
 
 	/// @brief Data that is received as part of a Channel update event.
 	struct DiscordCoreAPI_Dll OnChannelUpdateData : public UpdatedEventData<ChannelData, ChannelData> {
 		OnChannelUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+		/// @brief Parses the event and applies its cache updates without building it, for when nothing listens to it.
+		static void updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+	  protected:
+		static void updateCache(ChannelData& value);
 	};
 
 	/// @brief Data that is received as part of a Channel deletion event.
 	struct DiscordCoreAPI_Dll OnChannelDeletionData : public EventData<ChannelData> {
 		OnChannelDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+		/// @brief Parses the event and applies its cache updates without building it, for when nothing listens to it.
+		static void updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+	  protected:
+		static void updateCache(ChannelData& value);
 	};
 
 	/// @brief Data that is received as part of a Channel pins update event.
@@ -243,21 +261,45 @@ namespace DiscordCoreAPI {
 	/// @brief Data that is received as part of a Guild creation event.
 	struct DiscordCoreAPI_Dll OnGuildCreationData : public EventData<GuildData> {
 		OnGuildCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse, DiscordCoreClient*);
+
+		/// @brief Parses the event and applies its cache updates without building it, for when nothing listens to it.
+		static void updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse, DiscordCoreClient* client);
+
+	  protected:
+		static void updateCache(GuildData& value, DiscordCoreClient* client);
 	};
 
 	/// @brief Data that is received as part of a Guild update event.
 	struct DiscordCoreAPI_Dll OnGuildUpdateData : public UpdatedEventData<GuildData, GuildData> {
 		OnGuildUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse, DiscordCoreClient*);
+
+		/// @brief Parses the event and applies its cache updates without building it, for when nothing listens to it.
+		static void updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse, DiscordCoreClient* client);
+
+	  protected:
+		static void updateCache(GuildData& value, DiscordCoreClient* client);
 	};
 
 	/// @brief Data that is received as part of a Guild deletion event.
 	struct DiscordCoreAPI_Dll OnGuildDeletionData : public EventData<GuildData> {
 		OnGuildDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+		/// @brief Parses the event and applies its cache updates without building it, for when nothing listens to it.
+		static void updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+	  protected:
+		static void updateCache(GuildData& value);
 	};
 
 	/// @brief Data that is received as part of a Guild ban add event.
 	struct DiscordCoreAPI_Dll OnGuildBanAddData : public EventData<GuildBanAddData> {
 		OnGuildBanAddData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+		/// @brief Parses the event and applies its cache updates without building it, for when nothing listens to it.
+		static void updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+	  protected:
+		static void updateCache(GuildBanAddData& value);
 	};
 
 	/// @brief Data that is received as part of a Guild ban add event.
@@ -268,6 +310,12 @@ namespace DiscordCoreAPI {
 	/// @brief Data that is received as part of a Guild emojis update event.
 	struct DiscordCoreAPI_Dll OnGuildEmojisUpdateData : public EventData<GuildEmojisUpdateEventData> {
 		OnGuildEmojisUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+		/// @brief Parses the event and applies its cache updates without building it, for when nothing listens to it.
+		static void updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+	  protected:
+		static void updateCache(GuildEmojisUpdateEventData& value);
 	};
 
 	/// @brief Data that is received as part of a Guild sticker update event.
@@ -283,16 +331,34 @@ namespace DiscordCoreAPI {
 	/// @brief Data that is received as part of a GuildMember add event.
 	struct DiscordCoreAPI_Dll OnGuildMemberAddData : public EventData<GuildMemberData> {
 		OnGuildMemberAddData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+		/// @brief Parses the event and applies its cache updates without building it, for when nothing listens to it.
+		static void updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+	  protected:
+		static void updateCache(GuildMemberData& value);
 	};
 
 	/// @brief Data that is received as part of a GuildMember update event.
 	struct DiscordCoreAPI_Dll OnGuildMemberUpdateData : public UpdatedEventData<GuildMemberData, GuildMemberData> {
 		OnGuildMemberUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+		/// @brief Parses the event and applies its cache updates without building it, for when nothing listens to it.
+		static void updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+	  protected:
+		static void updateCache(GuildMemberData& value);
 	};
 
 	/// @brief Data that is received as part of a GuildMember remove event.
 	struct DiscordCoreAPI_Dll OnGuildMemberRemoveData : public EventData<GuildMemberRemoveData> {
 		OnGuildMemberRemoveData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+		/// @brief Parses the event and applies its cache updates without building it, for when nothing listens to it.
+		static void updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+	  protected:
+		static void updateCache(GuildMemberRemoveData& value);
 	};
 
 	/// @brief Data that is received as part of a GuildMembers chunk event.
@@ -303,16 +369,34 @@ namespace DiscordCoreAPI {
 	/// @brief Data that is received as part of a RoleData creation event.
 	struct DiscordCoreAPI_Dll OnRoleCreationData : public EventData<RoleCreationData> {
 		OnRoleCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+		/// @brief Parses the event and applies its cache updates without building it, for when nothing listens to it.
+		static void updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+	  protected:
+		static void updateCache(RoleCreationData& value);
 	};
 
 	/// @brief Data that is received as part of a RoleData update event.
 	struct DiscordCoreAPI_Dll OnRoleUpdateData : public UpdatedEventData<RoleUpdateData, RoleData> {
 		OnRoleUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+		/// @brief Parses the event and applies its cache updates without building it, for when nothing listens to it.
+		static void updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+	  protected:
+		static void updateCache(RoleUpdateData& value);
 	};
 
 	/// @brief Data that is received as part of a RoleData deletion event.
 	struct DiscordCoreAPI_Dll OnRoleDeletionData : public EventData<RoleDeletionData> {
 		OnRoleDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+		/// @brief Parses the event and applies its cache updates without building it, for when nothing listens to it.
+		static void updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse);
+
+	  protected:
+		static void updateCache(RoleDeletionData& value);
 	};
 
 	/// @brief Data that is received as part of a GuildScheduledEventData creation event.
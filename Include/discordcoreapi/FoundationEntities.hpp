@@ -293,9 +293,11 @@ namespace DiscordCoreAPI {
 			static UnorderedMap<HttpsWorkloadType, UniquePtr<std::atomic_int64_t>> workloadIdsInternal;
 
 			UnorderedMap<std::string, std::string> headersToInsert{};
+			Jsonifier::Vector<std::string> headersToCollect{};///< The lower-case names of the response headers to keep in responseHeaders.
 			PayloadType payloadType{ PayloadType::Application_Json };
 			std::atomic_int64_t thisWorkerId{};
 			HttpsWorkloadClass workloadClass{};
+			bool acceptCompressed{};
 			std::string relativePath{};
 			std::string callStack{};
 			std::string baseUrl{};
@@ -317,10 +319,50 @@ namespace DiscordCoreAPI {
 
 			HttpsWorkloadType getWorkloadType() const;
 
+			/// @brief Sets the relative path from its segments, sizing the string once instead of once per concatenation.
+			/// @tparam ArgTypes The types of the segments - strings, Snowflakes or integers.
+			/// @param args The segments of the path, in order.
+			template<typename... ArgTypes> inline void setRelativePath(const ArgTypes&... args) {
+				relativePath.clear();
+				appendToRelativePath(args...);
+			}
+
+			/// @brief Appends segments - such as query parameters - to the relative path, reserving their combined length up front.
+			/// @tparam ArgTypes The types of the segments - strings, Snowflakes or integers.
+			/// @param args The segments to append, in order.
+			template<typename... ArgTypes> inline void appendToRelativePath(const ArgTypes&... args) {
+				relativePath.reserve(relativePath.size() + (getSegmentLength(args) + ...));
+				(appendSegment(args), ...);
+			}
+
 		  protected:
+			static constexpr uint64_t maxIntegerDigits{ 20 };///< The most characters that a 64-bit integer can print as.
+
 			static int64_t incrementAndGetWorkloadId(HttpsWorkloadType workloadType);
 
 			HttpsWorkloadType workloadType{};
+
+			template<typename ValueType> inline static uint64_t getSegmentLength(const ValueType& value) {
+				if constexpr (std::same_as<ValueType, Snowflake> || std::integral<ValueType> || std::is_enum_v<ValueType>) {
+					return maxIntegerDigits;
+				} else {
+					return std::string_view{ value }.size();
+				}
+			}
+
+			template<typename ValueType> inline void appendSegment(const ValueType& value) {
+				if constexpr (std::same_as<ValueType, Snowflake>) {
+					appendSegment(value.operator const uint64_t&());
+				} else if constexpr (std::is_enum_v<ValueType>) {
+					appendSegment(static_cast<std::underlying_type_t<ValueType>>(value));
+				} else if constexpr (std::integral<ValueType>) {
+					char buffer[maxIntegerDigits]{};
+					auto result = std::to_chars(buffer, buffer + std::size(buffer), value);
+					relativePath.append(buffer, static_cast<uint64_t>(result.ptr - buffer));
+				} else {
+					relativePath += std::string_view{ value };
+				}
+			}
 		};
 
 		struct DiscordCoreAPI_Dll HelloData {
@@ -2703,6 +2745,7 @@ namespace DiscordCoreAPI {
 		friend class DiscordCoreInternal::WebSocketClient;
 		friend class DiscordCoreInternal::BaseSocketAgent;
 		friend class RespondToInputEventData;
+		friend class CommandController;
 		friend class DiscordCoreClient;
 		friend class CommandData;
 		friend class InputEvents;
@@ -3015,7 +3058,8 @@ namespace DiscordCoreAPI {
 	enum class SongType : uint8_t {
 		YouTube = 0,///< YouTube.
 		SoundCloud = 1,///< SoundCloud.
-		Neutral = 2///< For either type.
+		Neutral = 2,///< For either type.
+		Local = 3///< A file on the local disk - Song::songId holds its path.
 	};
 
 	/// @brief Represents a download Url.
@@ -3141,6 +3185,7 @@ namespace DiscordCoreAPI {
 	  public:
 		friend struct EventData<InteractionData>;
 		friend struct OnInteractionCreationData;
+		friend class CommandController;
 
 		CommandData() = default;
 
@@ -3223,8 +3268,19 @@ namespace DiscordCoreAPI {
 		~BaseFunctionArguments() = default;
 	};
 
+	/// @brief Where a command's execute function is run.
+	/// @details Inline commands are run one at a time, in the order they arrived, on their shard's command thread - a slow one delays the
+	/// shard's later Inline commands, but never its socket or heartbeat. A Dedicated command gets a thread of its own, so it never ties up a
+	/// pool worker however long it runs.
+	enum class CommandExecutionPolicy : uint8_t {
+		Pooled = 0,///< On the CoRoutine thread pool.
+		Inline = 1,///< In order, on a command thread belonging to the gateway shard that received the interaction - for light commands.
+		Dedicated = 2///< On a thread of its own, which exits once the command returns - for long-running commands.
+	};
+
 	/// @brief Base class for the command classes.
 	struct DiscordCoreAPI_Dll BaseFunction {
+		CommandExecutionPolicy executionPolicy{ CommandExecutionPolicy::Pooled };///< Where the command's execute function is run.
 		std::string helpDescription{};///< Description of the command for the Help command.
 		std::string commandName{};///< Name of the command for calling purposes.
 		EmbedData helpEmbed{};///< A Message embed for displaying the command via the Help command.
@@ -422,7 +422,7 @@ namespace DiscordCoreAPI {
 	  public:
 		friend class DiscordCoreClient;
 
-		static UnorderedMap<std::string, UnboundedMessageBlock<InteractionData>*> selectMenuInteractionBuffersMap;
+		static DiscordCoreInternal::CollectorRegistry<InteractionData> selectMenuCollectorRegistry;
 		static DiscordCoreInternal::TriggerEvent<void, InteractionData> selectMenuInteractionEventsMap;
 
 		/// @brief Constructor.
@@ -449,22 +449,20 @@ namespace DiscordCoreAPI {
 
 	  protected:
 		UniquePtr<InteractionData> interactionData{ makeUnique<InteractionData>() };
-		UnboundedMessageBlock<InteractionData> selectMenuIncomingInteractionBuffer{};
+		DiscordCoreInternal::CollectorBuffer<InteractionData> selectMenuIncomingInteractionBuffer{};
 		Jsonifier::Vector<SelectMenuResponseData> responseVector{};
 		CreateInteractionResponseData errorMessageData{};
 		int32_t currentCollectedSelectMenuCount{};
 		int32_t maxCollectedSelectMenuCount{};
 		Jsonifier::Vector<std::string> values{};
 		bool getSelectMenuDataForAll{};
-		std::string buffersMapKey{};
 		std::string selectMenuId{};
+		uint64_t collectorId{};
 		uint32_t maxTimeInMs{};
 		Snowflake channelId{};
 		Snowflake messageId{};
 		Snowflake userId{};
 		bool doWeQuit{};
-
-		void run();
 	};
 
 	/// @brief Button response data.
@@ -520,7 +518,7 @@ namespace DiscordCoreAPI {
 	  public:
 		friend class DiscordCoreClient;
 
-		static UnorderedMap<std::string, UnboundedMessageBlock<InteractionData>*> buttonInteractionBuffersMap;
+		static DiscordCoreInternal::CollectorRegistry<InteractionData> buttonCollectorRegistry;
 		static DiscordCoreInternal::TriggerEvent<void, InteractionData> buttonInteractionEventsMap;
 
 		/// @brief Constructor.
@@ -547,22 +545,20 @@ namespace DiscordCoreAPI {
 
 	  protected:
 		UniquePtr<InteractionData> interactionData{ makeUnique<InteractionData>() };
-		UnboundedMessageBlock<InteractionData> buttonIncomingInteractionBuffer{};
+		DiscordCoreInternal::CollectorBuffer<InteractionData> buttonIncomingInteractionBuffer{};
 		CreateInteractionResponseData errorMessageData{};
 		Jsonifier::Vector<ButtonResponseData> responseVector{};
 		int32_t currentCollectedButtonCount{};
 		int32_t maxCollectedButtonCount{};
 		Jsonifier::Vector<std::string> values{};
-		std::string buffersMapKey{};
 		bool getButtonDataForAll{};
+		uint64_t collectorId{};
 		uint32_t maxTimeInMs{};
 		std::string buttonId{};
 		Snowflake channelId{};
 		Snowflake messageId{};
 		Snowflake userId{};
 		bool doWeQuit{};
-
-		void run();
 	};
 
 	/// @brief Button response data.
@@ -602,7 +598,7 @@ namespace DiscordCoreAPI {
 	  public:
 		friend class DiscordCoreClient;
 
-		static UnorderedMap<std::string, UnboundedMessageBlock<InteractionData>*> modalInteractionBuffersMap;
+		static DiscordCoreInternal::CollectorRegistry<InteractionData> modalCollectorRegistry;
 		static DiscordCoreInternal::TriggerEvent<void, InteractionData> modalInteractionEventsMap;
 
 		/// @brief Constructor.
@@ -623,15 +619,14 @@ namespace DiscordCoreAPI {
 		~ModalCollector();
 
 	  protected:
-		UnboundedMessageBlock<InteractionData> modalIncomingInteractionBuffer{};
+		DiscordCoreInternal::CollectorBuffer<InteractionData> modalIncomingInteractionBuffer{};
 		CreateInteractionResponseData errorMessageData{};
 		int32_t currentCollectedButtonCount{};
 		ModalResponseData responseData{};
 		uint32_t maxTimeInMs{};
+		uint64_t collectorId{};
 		Snowflake channelId{};
 		bool doWeQuit{};
-
-		void run();
 	};
 
 	/**@}*/
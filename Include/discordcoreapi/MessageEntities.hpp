@@ -33,6 +33,7 @@
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
 #include <discordcoreapi/CoRoutine.hpp>
+#include <discordcoreapi/Utilities/CollectorRegistry.hpp>
 
 namespace DiscordCoreAPI {
 
@@ -52,30 +53,32 @@ namespace DiscordCoreAPI {
 			Jsonifier::Vector<ValueType> objects{};///< A vector of collected Objects.
 		};
 
-		static UnorderedMap<std::string, UnboundedMessageBlock<ValueType>*> objectsBuffersMap;
+		static DiscordCoreInternal::CollectorRegistry<ValueType> collectorRegistry;
 
-		ObjectCollector();
+		/// @brief Constructor - only Objects that match the given ids are delivered to the collector, where an id of 0 matches any id.
+		/// @param channelIdNew The id of the ChannelData to collect Objects from.
+		/// @param messageIdNew The id of the Message to collect Objects from.
+		/// @param userIdNew The id of the UserData to collect Objects from.
+		ObjectCollector(Snowflake channelIdNew = Snowflake{}, Snowflake messageIdNew = Snowflake{}, Snowflake userIdNew = Snowflake{});
 
 		/// @brief Begin waiting for Objects.
 		/// @param quantityToCollect Maximum quantity of Objects to collect before returning the results.
 		/// @param msToCollectForNew Maximum number of Milliseconds to wait for Objects before returning the results.
 		/// @param filteringFunctionNew A filter function to apply to new Objects, where returning "true" from the function results in a Object being stored.
 		/// @return A ObjectCollectorReturnData structure.
+		/// @details The CoRoutine is suspended between Objects, so that a waiting collector holds onto no thread.
 		CoRoutine<ObjectCollectorReturnData> collectObjects(int32_t quantityToCollect, int32_t msToCollectForNew,
 			ObjectFilter<ValueType> filteringFunctionNew);
 
-		void run(std::coroutine_handle<typename DiscordCoreAPI::CoRoutine<
-				typename DiscordCoreAPI::ObjectCollector<ValueType>::ObjectCollectorReturnData>::promise_type>& coroHandle);
-
 		~ObjectCollector();
 
 	  protected:
-		UnboundedMessageBlock<ValueType> objectsBuffer{};
+		DiscordCoreInternal::CollectorBuffer<ValueType> objectsBuffer{};
 		ObjectCollectorReturnData objectReturnData{};
 		ObjectFilter<ValueType> filteringFunction{};
 		int32_t quantityOfObjectsToCollect{};
-		std::string collectorId{};
 		int32_t msToCollectFor{};
+		uint64_t collectorId{};
 	};
 
 	using MessageCollector = ObjectCollector<MessageData>;
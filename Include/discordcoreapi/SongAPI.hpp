@@ -32,6 +32,7 @@
 
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/Utilities/EventEntities.hpp>
+#include <discordcoreapi/Utilities/AudioCache.hpp>
 #include <discordcoreapi/GuildMemberEntities.hpp>
 #include <discordcoreapi/VoiceConnection.hpp>
 
@@ -52,7 +53,7 @@ namespace DiscordCoreAPI {
 		friend class GuildData;
 
 		DiscordCoreInternal::Event<CoRoutine<void, false>, SongCompletionEventData> onSongCompletionEvent{};
-		UnboundedMessageBlock<AudioFrameData> audioDataBuffer{};
+		BoundedMessageBlock<AudioFrameData> audioDataBuffers[2];///< The playing Song's frames, and the prefetched next Song's frames.
 		DiscordCoreInternal::EventDelegateToken eventToken{};
 
 		SongAPI(Snowflake guildId);
@@ -78,6 +79,18 @@ namespace DiscordCoreAPI {
 		/// @return A bool suggesting the success or failure of the play command.
 		bool play(Song songNew, const GuildMemberData& guildMember);
 
+		/// @brief Sets the Song that follows the current one, so that it can be prefetched and played without a gap.
+		/// @details The Song is prefetched once the current one has been playing for AudioOptions::prefetchAfterInMs, or has finished
+		/// downloading. When the current Song ends, playback moves straight on to it - and a subsequent call to play() with the same Song,
+		/// from the song completion handler, simply continues it.
+		/// @param songNew The Song to play next.
+		/// @param guildMember The GuildMemberData that is queueing this song.
+		void setNextSong(Song songNew, const GuildMemberData& guildMember);
+
+		/// @brief Collects the message block that the VoiceConnection is currently playing from.
+		/// @return A reference to the active audio message block.
+		BoundedMessageBlock<AudioFrameData>& getActiveBuffer();
+
 		/// @brief Checks if there is currently playing music for the current Guild.
 		/// @return A bool representing the currently playing status.
 		bool areWeCurrentlyPlaying() const;
@@ -97,9 +110,66 @@ namespace DiscordCoreAPI {
 		~SongAPI();
 
 	  protected:
-		CoRoutine<void, false> taskThread{};
-		std::recursive_mutex accessMutex{};
+		/// @brief How far the next Song's prefetch has got.
+		enum class PrefetchState : uint8_t {
+			Idle = 0,///< Nothing is being prefetched.
+			Waiting = 1,///< Waiting for the current Song to reach the prefetch point.
+			Started = 2,///< Streaming into the standby buffer, ready to be handed off.
+			Failed = 3///< The download failed - the Song is downloaded normally when it is played.
+		};
+
+		std::condition_variable prefetchCondition{};///< Wakes the prefetch once it is due, or cancelled.
+		CoRoutine<void, false> taskThreads[2]{};
+		CoRoutine<void, false> prefetchThread{};
+		std::atomic_uint64_t framesPlayed{};
+		std::recursive_mutex accessMutex{};///< Serializes the public calls - may be held across downloads and cancellations.
+		uint64_t prefetchAfterInFrames{};
+		std::atomic_uint8_t activeLane{};
+		std::mutex prefetchMutex{};///< Guards the prefetch and handoff state below - only ever held briefly, as the voice thread takes it.
+		PrefetchState prefetchState{};
+		bool wasPendingSkipAFail{};
+		bool isPrefetchCancelled{};
+		bool isHandOffBlocked{};
+		bool isThereANextSong{};
+		bool isPrefetchDue{};
+		bool wasItHandedOff{};
+		bool isSkipPending{};///< The standby Song finished downloading before it was handed off, so its skip is still to be applied.
+		Song currentSong{};
 		Snowflake guildId{};
+		Song nextSong{};
+
+		CoRoutine<void, false> streamCachedSong(Song songNew, CachedSong cachedSong, BoundedMessageBlock<AudioFrameData>& audioDataBuffer);
+
+		CoRoutine<void, false> streamLocalSong(Song songNew, BoundedMessageBlock<AudioFrameData>& audioDataBuffer);
+
+		CoRoutine<void, false> createProducer(Song songNew, BoundedMessageBlock<AudioFrameData>& audioDataBuffer);
+
+		CoRoutine<void, false> prefetchSong(Song songNew);
+
+		/// @brief Called by a producer once it has sent its last frame - skips the VoiceConnection to the end-of-song frame, or defers that
+		/// until the handoff if the producer is filling the standby buffer.
+		/// @param audioDataBuffer The buffer that the producer filled.
+		/// @param wasItAFail Whether or not the Song failed to play.
+		void onDownloadComplete(BoundedMessageBlock<AudioFrameData>& audioDataBuffer, bool wasItAFail = false);
+
+		/// @brief Called by a producer that failed for good.
+		/// @param audioDataBuffer The buffer that the producer filled.
+		/// @return False if the buffer is the active one, in which case the caller skips the Song instead.
+		bool onPrefetchFailed(BoundedMessageBlock<AudioFrameData>& audioDataBuffer);
+
+		bool isItTheActiveBuffer(BoundedMessageBlock<AudioFrameData>& audioDataBuffer);
+
+		void cancelProducer(uint8_t lane);
+
+		void switchToStandby();
+
+		bool handOffToNextSong();
+
+		void onHandOffComplete();
+
+		void cancelPrefetch();
+
+		void onFramePlayed();
 
 		void disconnect();
 	};
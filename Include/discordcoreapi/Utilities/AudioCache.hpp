@@ -0,0 +1,493 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// AudioCache.hpp - Header file for the on-disk Opus audio cache.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file AudioCache.hpp
+
+#pragma once
+
+#include <discordcoreapi/FoundationEntities.hpp>
+#include <filesystem>
+#include <charconv>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <cstring>
+#include <list>
+
+#ifndef _WIN32
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+namespace DiscordCoreAPI {
+
+	/**
+	 * \addtogroup voice_connection
+	 * @{
+	 */
+
+	/// @brief A read-only memory-mapping of an entire file.
+	class MemoryMappedFile {
+	  public:
+		inline MemoryMappedFile() = default;
+
+		inline MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept {
+			if (this != &other) {
+				unmap();
+				std::swap(mappedData, other.mappedData);
+				std::swap(mappedSize, other.mappedSize);
+#ifdef _WIN32
+				std::swap(mappingHandle, other.mappingHandle);
+				std::swap(fileHandle, other.fileHandle);
+#endif
+			}
+			return *this;
+		}
+
+		inline MemoryMappedFile(MemoryMappedFile&& other) noexcept {
+			*this = std::move(other);
+		}
+
+		inline MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+		inline MemoryMappedFile(const MemoryMappedFile&) = delete;
+
+		/// @brief Maps a file into memory.
+		/// @param path The path of the file to map.
+		/// @return True if the file was mapped, false otherwise.
+		inline bool map(const std::filesystem::path& path) {
+			unmap();
+#ifdef _WIN32
+			fileHandle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (fileHandle == INVALID_HANDLE_VALUE) {
+				return false;
+			}
+			LARGE_INTEGER fileSize{};
+			if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+				unmap();
+				return false;
+			}
+			mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (!mappingHandle) {
+				unmap();
+				return false;
+			}
+			mappedData = static_cast<const uint8_t*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+			if (!mappedData) {
+				unmap();
+				return false;
+			}
+			mappedSize = static_cast<uint64_t>(fileSize.QuadPart);
+#else
+			int32_t fileDescriptor = open(path.c_str(), O_RDONLY);
+			if (fileDescriptor == -1) {
+				return false;
+			}
+			struct stat fileStats {};
+			if (fstat(fileDescriptor, &fileStats) == -1 || fileStats.st_size == 0) {
+				close(fileDescriptor);
+				return false;
+			}
+			void* newData = mmap(nullptr, static_cast<size_t>(fileStats.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+			close(fileDescriptor);
+			if (newData == MAP_FAILED) {
+				return false;
+			}
+			mappedData = static_cast<const uint8_t*>(newData);
+			mappedSize = static_cast<uint64_t>(fileStats.st_size);
+#endif
+			return true;
+		}
+
+		/// @brief Collects a view of the mapped file.
+		/// @return A view of the entire mapped file - empty if nothing is mapped.
+		inline std::basic_string_view<uint8_t> getData() const {
+			return { mappedData, mappedSize };
+		}
+
+		inline ~MemoryMappedFile() {
+			unmap();
+		}
+
+	  protected:
+		const uint8_t* mappedData{};
+		uint64_t mappedSize{};
+#ifdef _WIN32
+		HANDLE fileHandle{ INVALID_HANDLE_VALUE };
+		HANDLE mappingHandle{};
+#endif
+
+		inline void unmap() {
+#ifdef _WIN32
+			if (mappedData) {
+				UnmapViewOfFile(mappedData);
+			}
+			if (mappingHandle) {
+				CloseHandle(mappingHandle);
+				mappingHandle = nullptr;
+			}
+			if (fileHandle != INVALID_HANDLE_VALUE) {
+				CloseHandle(fileHandle);
+				fileHandle = INVALID_HANDLE_VALUE;
+			}
+#else
+			if (mappedData) {
+				munmap(const_cast<uint8_t*>(mappedData), static_cast<size_t>(mappedSize));
+			}
+#endif
+			mappedData = nullptr;
+			mappedSize = 0;
+		}
+	};
+
+	/// @brief The layout of an AudioCache entry.
+	/// @details An entry is the concatenation of every Opus frame of a Song, followed by a uint64_t offset for each frame plus one for the
+	/// end of the final frame, followed by the Song's source id, followed by this trailer. Frame x spans [offsets[x], offsets[x + 1]).
+	struct AudioCacheTrailer {
+		static constexpr uint32_t magicValue{ 0x43414344 };///< Identifies the file as an AudioCache entry.
+		static constexpr uint32_t currentVersion{ 2 };
+
+		uint64_t sourceIdLength{};///< The length of the source id that precedes the trailer.
+		uint64_t frameCount{};///< The number of Opus frames in the entry.
+		uint32_t version{ currentVersion };///< The version of the entry layout.
+		uint32_t magic{ magicValue };///< The entry's magic value.
+	};
+
+	/// @brief A Song that has been loaded from the AudioCache - its frames are served straight out of the memory-mapped entry.
+	class CachedSong {
+	  public:
+		inline CachedSong() = default;
+
+		/// @brief Maps and validates an AudioCache entry.
+		/// @param path The path of the entry.
+		/// @param sourceId The source id that the entry has to have been written for.
+		/// @return True if the entry was mapped, is well-formed and belongs to sourceId, false otherwise.
+		inline bool open(const std::filesystem::path& path, std::string_view sourceId) {
+			frameCount = 0;
+			if (!file.map(path)) {
+				return false;
+			}
+			auto data = file.getData();
+			if (data.size() < sizeof(AudioCacheTrailer)) {
+				return false;
+			}
+			AudioCacheTrailer trailer{};
+			std::memcpy(&trailer, data.data() + data.size() - sizeof(AudioCacheTrailer), sizeof(AudioCacheTrailer));
+			if (trailer.magic != AudioCacheTrailer::magicValue || trailer.version != AudioCacheTrailer::currentVersion) {
+				return false;
+			}
+			uint64_t payloadSize = data.size() - sizeof(AudioCacheTrailer);
+			if (trailer.sourceIdLength != sourceId.size() || trailer.sourceIdLength > payloadSize) {
+				return false;
+			}
+			payloadSize -= trailer.sourceIdLength;
+			if (std::memcmp(data.data() + payloadSize, sourceId.data(), sourceId.size()) != 0) {
+				return false;
+			}
+			if (trailer.frameCount >= payloadSize / sizeof(uint64_t)) {
+				return false;
+			}
+			uint64_t indexSize = (trailer.frameCount + 1) * sizeof(uint64_t);
+			offsetsOffset = payloadSize - indexSize;
+			uint64_t previousOffset{};
+			for (uint64_t x = 0; x <= trailer.frameCount; ++x) {
+				uint64_t currentOffset = getOffset(x);
+				if (currentOffset < previousOffset || currentOffset > offsetsOffset) {
+					return false;
+				}
+				previousOffset = currentOffset;
+			}
+			frameCount = trailer.frameCount;
+			return true;
+		}
+
+		/// @brief Collects the number of frames in the entry.
+		/// @return The number of Opus frames.
+		inline uint64_t getFrameCount() const {
+			return frameCount;
+		}
+
+		/// @brief Collects a frame, without copying it out of the mapping.
+		/// @param index The index of the frame to collect.
+		/// @return A view of the Opus frame.
+		inline std::basic_string_view<uint8_t> getFrame(uint64_t index) const {
+			uint64_t startOffset = getOffset(index);
+			return { file.getData().data() + startOffset, getOffset(index + 1) - startOffset };
+		}
+
+	  protected:
+		MemoryMappedFile file{};
+		uint64_t offsetsOffset{};
+		uint64_t frameCount{};
+
+		inline uint64_t getOffset(uint64_t index) const {
+			uint64_t returnValue{};
+			std::memcpy(&returnValue, file.getData().data() + offsetsOffset + index * sizeof(uint64_t), sizeof(uint64_t));
+			return returnValue;
+		}
+	};
+
+	class AudioCache;
+
+	/// @brief Writes a new AudioCache entry, one frame at a time.
+	/// @details Frames are written to a temporary file, which is only moved into place by finalize() - so a Song that fails, or is stopped,
+	/// part-way through never leaves a truncated entry behind.
+	class AudioCacheWriter {
+	  public:
+		friend class AudioCache;
+
+		inline AudioCacheWriter& operator=(AudioCacheWriter&&) noexcept = default;
+		inline AudioCacheWriter(AudioCacheWriter&&) noexcept = default;
+
+		inline AudioCacheWriter& operator=(const AudioCacheWriter&) = delete;
+		inline AudioCacheWriter(const AudioCacheWriter&) = delete;
+
+		/// @brief Appends a frame to the entry.
+		/// @param frame The Opus frame to append.
+		inline void writeFrame(std::basic_string_view<uint8_t> frame) {
+			if (!stream.is_open()) {
+				return;
+			}
+			offsets.emplace_back(currentOffset);
+			stream.write(reinterpret_cast<const char*>(frame.data()), static_cast<std::streamsize>(frame.size()));
+			currentOffset += frame.size();
+		}
+
+		/// @brief Writes the frame index, and moves the finished entry into the cache.
+		/// @return True if the entry was stored, false otherwise.
+		inline bool finalize();
+
+		inline ~AudioCacheWriter() {
+			if (stream.is_open()) {
+				stream.close();
+				std::error_code errorCode{};
+				std::filesystem::remove(temporaryPath, errorCode);
+			}
+		}
+
+	  protected:
+		std::filesystem::path temporaryPath{};
+		std::filesystem::path finalPath{};
+		std::vector<uint64_t> offsets{};
+		uint64_t currentOffset{};
+		std::string sourceId{};
+		AudioCache* cache{};
+		std::ofstream stream{};
+		uint64_t key{};
+
+		inline AudioCacheWriter(AudioCache* cacheNew, uint64_t keyNew, std::string sourceIdNew, std::filesystem::path temporaryPathNew,
+			std::filesystem::path finalPathNew)
+			: temporaryPath{ std::move(temporaryPathNew) }, finalPath{ std::move(finalPathNew) }, sourceId{ std::move(sourceIdNew) },
+			  cache{ cacheNew }, key{ keyNew } {
+			stream.open(temporaryPath, std::ios::binary | std::ios::trunc);
+		}
+	};
+
+	/// @brief A content-addressed, on-disk cache of demuxed Opus frames, keyed by each Song's source id.
+	/// @details Entries are evicted in least-recently-played order once their total size exceeds the configured budget. The recency of each
+	/// entry is stored as its file's modification time, so it survives restarts - and the cache may be pre-seeded offline, by writing entries
+	/// with an AudioCacheWriter into the cache directory.
+	class AudioCache {
+	  public:
+		friend class AudioCacheWriter;
+
+		/// @brief Constructor for AudioCache.
+		/// @param directoryNew The directory to keep the entries in - it is created if it does not exist.
+		/// @param sizeBudgetNew The maximum combined size of the entries, in bytes.
+		inline AudioCache(const std::filesystem::path& directoryNew, uint64_t sizeBudgetNew) : directory{ directoryNew }, sizeBudget{ sizeBudgetNew } {
+			std::error_code errorCode{};
+			std::filesystem::create_directories(directory, errorCode);
+			std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::directory_entry>> entries{};
+			for (auto& entry: std::filesystem::directory_iterator{ directory, errorCode }) {
+				if (!entry.is_regular_file(errorCode)) {
+					continue;
+				}
+				if (entry.path().extension() == temporaryExtension) {
+					std::filesystem::remove(entry.path(), errorCode);
+				} else if (entry.path().extension() == entryExtension) {
+					entries.emplace_back(entry.last_write_time(errorCode), entry);
+				}
+			}
+			std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+				return lhs.first < rhs.first;
+			});
+			std::unique_lock lock{ accessMutex };
+			for (auto& [writeTime, entry]: entries) {
+				uint64_t key{};
+				auto stem = entry.path().stem().string();
+				if (std::from_chars(stem.data(), stem.data() + stem.size(), key, 16).ec != std::errc{}) {
+					continue;
+				}
+				insertEntry(key, entry.file_size(errorCode));
+			}
+			evictToBudget();
+		}
+
+		inline AudioCache& operator=(const AudioCache&) = delete;
+		inline AudioCache(const AudioCache&) = delete;
+
+		/// @brief Collects the source id of a Song, which is stored in its entry - and checked on open, so that a key collision or a stale
+		/// pre-seeded file can never play the wrong Song.
+		/// @param song The Song to collect the source id of.
+		/// @return The Song's type and id, as "type:songId".
+		inline static std::string getSourceId(const Song& song) {
+			return std::to_string(static_cast<uint32_t>(song.type)) + ":" + song.songId;
+		}
+
+		/// @brief Collects the key of a Song, which is a hash of its source id.
+		/// @param song The Song to collect the key of.
+		/// @return The Song's key.
+		inline static uint64_t getKey(const Song& song) {
+			return KeyHasher{}(getSourceId(song));
+		}
+
+		/// @brief Opens a Song's entry, if it is present, and marks it as the most-recently-played.
+		/// @param song The Song to look up.
+		/// @param cachedSong The object to load the entry into.
+		/// @return True if the entry was found and is valid, false otherwise.
+		inline bool tryOpen(const Song& song, CachedSong& cachedSong) {
+			uint64_t key = getKey(song);
+			std::unique_lock lock{ accessMutex };
+			if (!entries.contains(key)) {
+				return false;
+			}
+			auto path = getEntryPath(key);
+			if (!cachedSong.open(path, getSourceId(song))) {
+				removeEntry(key);
+				return false;
+			}
+			recency.splice(recency.end(), recency, entries[key].recencyIterator);
+			std::error_code errorCode{};
+			std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), errorCode);
+			return true;
+		}
+
+		/// @brief Creates a writer for a new entry.
+		/// @param song The Song whose frames will be written.
+		/// @return An AudioCacheWriter for the Song.
+		inline AudioCacheWriter createWriter(const Song& song) {
+			uint64_t key = getKey(song);
+			auto temporaryPath = directory / (toHexString(key) + "-" + std::to_string(writerCount.fetch_add(1)) + std::string{ temporaryExtension });
+			return AudioCacheWriter{ this, key, getSourceId(song), std::move(temporaryPath), getEntryPath(key) };
+		}
+
+		/// @brief Collects the combined size of the entries.
+		/// @return The size of the entries, in bytes.
+		inline uint64_t getTotalSize() {
+			std::unique_lock lock{ accessMutex };
+			return totalSize;
+		}
+
+	  protected:
+		static constexpr std::string_view temporaryExtension{ ".tmp" };
+		static constexpr std::string_view entryExtension{ ".dcac" };
+
+		struct CacheEntry {
+			std::list<uint64_t>::iterator recencyIterator{};
+			uint64_t size{};
+		};
+
+		std::atomic_uint64_t writerCount{};
+		UnorderedMap<uint64_t, CacheEntry> entries{};
+		std::filesystem::path directory{};
+		std::list<uint64_t> recency{};
+		std::mutex accessMutex{};
+		uint64_t sizeBudget{};
+		uint64_t totalSize{};
+
+		inline static std::string toHexString(uint64_t key) {
+			std::stringstream stream{};
+			stream << std::hex << std::setw(16) << std::setfill('0') << key;
+			return stream.str();
+		}
+
+		inline std::filesystem::path getEntryPath(uint64_t key) const {
+			return directory / (toHexString(key) + std::string{ entryExtension });
+		}
+
+		inline void insertEntry(uint64_t key, uint64_t size) {
+			if (entries.contains(key)) {
+				totalSize -= entries[key].size;
+				recency.erase(entries[key].recencyIterator);
+				entries.erase(key);
+			}
+			recency.emplace_back(key);
+			entries[key] = CacheEntry{ std::prev(recency.end()), size };
+			totalSize += size;
+		}
+
+		inline void removeEntry(uint64_t key) {
+			std::error_code errorCode{};
+			std::filesystem::remove(getEntryPath(key), errorCode);
+			totalSize -= entries[key].size;
+			recency.erase(entries[key].recencyIterator);
+			entries.erase(key);
+		}
+
+		inline void evictToBudget() {
+			while (totalSize > sizeBudget && recency.size() > 1) {
+				removeEntry(recency.front());
+			}
+		}
+
+		inline bool commitEntry(AudioCacheWriter& writer) {
+			std::error_code errorCode{};
+			std::unique_lock lock{ accessMutex };
+			std::filesystem::rename(writer.temporaryPath, writer.finalPath, errorCode);
+			if (errorCode) {
+				std::filesystem::remove(writer.temporaryPath, errorCode);
+				return false;
+			}
+			insertEntry(writer.key, std::filesystem::file_size(writer.finalPath, errorCode));
+			evictToBudget();
+			return true;
+		}
+	};
+
+	inline bool AudioCacheWriter::finalize() {
+		if (!stream.is_open() || offsets.empty()) {
+			return false;
+		}
+		offsets.emplace_back(currentOffset);
+		AudioCacheTrailer trailer{};
+		trailer.sourceIdLength = sourceId.size();
+		trailer.frameCount = offsets.size() - 1;
+		stream.write(reinterpret_cast<const char*>(offsets.data()), static_cast<std::streamsize>(offsets.size() * sizeof(uint64_t)));
+		stream.write(sourceId.data(), static_cast<std::streamsize>(sourceId.size()));
+		stream.write(reinterpret_cast<const char*>(&trailer), sizeof(trailer));
+		stream.close();
+		if (stream.fail()) {
+			std::error_code errorCode{};
+			std::filesystem::remove(temporaryPath, errorCode);
+			return false;
+		}
+		return cache->commitEntry(*this);
+	}
+	/**@}*/
+}
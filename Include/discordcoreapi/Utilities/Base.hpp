@@ -85,6 +85,7 @@ inline std::tm getCurrentTimeVal(time_t& result) {
 #include <shared_mutex>
 #include <immintrin.h>
 #include <functional>
+#include <charconv>
 #include <semaphore>
 #include <concepts>
 #include <iostream>
@@ -859,16 +860,31 @@ namespace DiscordCoreAPI {
 			return lhsNew;
 		}
 
-		/// @brief Friend function to concatenate two data.
+		/// @brief Friend function to concatenate two data - an rvalue string on the left is appended to in place, rather than copied.
 		/// @tparam ValueType01 The type of the first value.
 		/// @tparam ValueType02 The type of the second value.
 		/// @param lhs The first value.
 		/// @param rhs The second value.
 		/// @return The concatenated string.
-		template<StringT ValueType01, typename ValueType02> friend inline std::string operator+(const ValueType01& lhs, const ValueType02& rhs) {
-			std::string newString{ lhs };
-			newString += rhs;
-			return newString;
+		template<StringT ValueType01, typename ValueType02> friend inline std::string operator+(ValueType01&& lhs, const ValueType02& rhs) {
+			std::string newString{ std::forward<ValueType01>(lhs) };
+			if constexpr (std::same_as<ValueType02, Snowflake>) {
+				return std::move(newString) + rhs;
+			} else {
+				newString += rhs;
+				return newString;
+			}
+		}
+
+		/// @brief Friend function to append a Snowflake to a string, writing its digits straight into the string's buffer.
+		/// @param lhs The string to append to.
+		/// @param rhs The Snowflake to append.
+		/// @return The concatenated string.
+		friend inline std::string operator+(std::string&& lhs, const Snowflake& rhs) {
+			char buffer[20]{};
+			auto result = std::to_chars(buffer, buffer + std::size(buffer), rhs.id);
+			lhs.append(buffer, static_cast<uint64_t>(result.ptr - buffer));
+			return std::move(lhs);
 		}
 
 		/// @brief Converts the Snowflake ID into a time and date stamp.
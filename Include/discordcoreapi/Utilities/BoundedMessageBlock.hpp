@@ -0,0 +1,163 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// BoundedMessageBlock.hpp - Header file for the "BoundedMessageBlock" stuff.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file BoundedMessageBlock.hpp
+
+#pragma once
+
+#include <discordcoreapi/Utilities/Base.hpp>
+#include <condition_variable>
+
+namespace DiscordCoreAPI {
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief A bounded, single-producer/single-consumer ring of recycled slots, for data-structures.
+	/// @details Objects are swapped into and out of the ring's slots, rather than moved, so that whatever storage a slot holds is handed back
+	/// to the caller and reused instead of being reallocated. Additional producers (or consumers) are serialized against each other, but never
+	/// against the opposite side of the ring.
+	/// @tparam ValueType The type of object that will be sent over the message block.
+	template<CopyableOrMovable ValueType> class BoundedMessageBlock {
+	  public:
+		/// @brief Constructor for BoundedMessageBlock.
+		/// @param capacityNew The maximum number of objects that the ring can hold.
+		inline BoundedMessageBlock(uint64_t capacityNew) : slots(std::max<uint64_t>(capacityNew, 1)) {
+		}
+
+		inline BoundedMessageBlock<std::decay_t<ValueType>>& operator=(const BoundedMessageBlock<std::decay_t<ValueType>>&) = delete;
+		inline BoundedMessageBlock(const BoundedMessageBlock&) = delete;
+
+		inline ~BoundedMessageBlock() = default;
+
+		/// @brief Sends an object, waiting while the ring is full.
+		/// @param object The object to send - it is left holding the storage of the slot that it replaced.
+		/// @param doWeStop A predicate that is checked while waiting, which returns true to abandon the send - whatever makes it true has to call
+		/// wakeSenders() afterwards, as the wait has no timeout.
+		/// @return True if the object was sent, false if the send was abandoned.
+		template<typename PredicateType> inline bool send(ValueType& object, PredicateType&& doWeStop) {
+			while (!trySend(object)) {
+				std::unique_lock lock{ waitMutex };
+				spaceCondition.wait(lock, [&] {
+					return !isItFull() || doWeStop();
+				});
+				if (doWeStop()) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/// @brief Sends an object, if there is room for it.
+		/// @param object The object to send - it is left holding the storage of the slot that it replaced.
+		/// @return True if the object was sent, false if the ring was full.
+		inline bool trySend(ValueType& object) {
+			std::unique_lock lock{ producerMutex };
+			uint64_t currentHead{ head.load(std::memory_order_relaxed) };
+			if (currentHead - tail.load(std::memory_order_acquire) >= slots.size()) {
+				return false;
+			}
+			std::swap(slots[currentHead % slots.size()], object);
+			head.store(currentHead + 1, std::memory_order_release);
+			return true;
+		}
+
+		/// @brief Receives an object, if one is available.
+		/// @param object The object to receive into - its previous storage is recycled into the ring.
+		/// @return True if an object was received, false if the ring was empty.
+		inline bool tryReceive(ValueType& object) {
+			std::unique_lock lock{ consumerMutex };
+			uint64_t currentTail{ tail.load(std::memory_order_relaxed) };
+			if (currentTail == head.load(std::memory_order_acquire)) {
+				return false;
+			}
+			std::swap(object, slots[currentTail % slots.size()]);
+			tail.store(currentTail + 1, std::memory_order_release);
+			lock.unlock();
+			wakeSenders();
+			return true;
+		}
+
+		/// @brief Discards all of the objects that are currently in the ring.
+		inline void clearContents() {
+			std::unique_lock lock{ consumerMutex };
+			tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+			lock.unlock();
+			wakeSenders();
+		}
+
+		/// @brief Discards all of the objects that are currently in the ring, and then sends an object, without ever waiting.
+		/// @param object The object to send - it is left holding the storage of the slot that it replaced.
+		inline void clearContentsAndSend(ValueType& object) {
+			std::scoped_lock lock{ consumerMutex, producerMutex };
+			uint64_t currentHead{ head.load(std::memory_order_relaxed) };
+			std::swap(slots[currentHead % slots.size()], object);
+			tail.store(currentHead, std::memory_order_release);
+			head.store(currentHead + 1, std::memory_order_release);
+			wakeSenders();
+		}
+
+		/// @brief Wakes any sender that is waiting for room, so that it re-checks both the ring and its doWeStop predicate.
+		inline void wakeSenders() {
+			std::unique_lock lock{ waitMutex };
+			spaceCondition.notify_all();
+		}
+
+		/// @brief Checks if the ring is full.
+		/// @return True if the ring is full, otherwise false.
+		inline bool isItFull() {
+			return size() >= slots.size();
+		}
+
+		/// @brief Collects the number of objects that are currently in the ring.
+		/// @return The number of objects in the ring.
+		inline uint64_t size() {
+			return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+		}
+
+		/// @brief Collects the maximum number of objects that the ring can hold.
+		/// @return The capacity of the ring.
+		inline uint64_t capacity() {
+			return slots.size();
+		}
+
+	  protected:
+		alignas(64) std::atomic_uint64_t head{};
+		alignas(64) std::atomic_uint64_t tail{};
+		std::vector<std::decay_t<ValueType>> slots{};
+		std::condition_variable spaceCondition{};
+		std::mutex producerMutex{};
+		std::mutex consumerMutex{};
+		std::mutex waitMutex{};
+	};
+
+	/**@}*/
+
+}
@@ -46,11 +46,11 @@ namespace DiscordCoreAPI {
 
 		/// @brief A struct representing a worker thread for coroutine-based tasks.
 		struct WorkerThread {
-			inline WorkerThread() = default;
+			inline WorkerThread() : tasks(1024) {};
 
 			inline ~WorkerThread() = default;
 
-			UnboundedMessageBlock<std::coroutine_handle<>> tasks{};///< Queue of coroutine tasks.
+			MPMCQueue<std::coroutine_handle<>> tasks;///< Queue of coroutine tasks.
 			std::atomic_bool areWeCurrentlyWorking{};///< Atomic flag indicating if the thread is working.
 			ThreadWrapper thread{};///< Joinable thread.
 		};
@@ -62,6 +62,7 @@ namespace DiscordCoreAPI {
 
 			/// @brief Constructor to create a coroutine thread pool. Initializes the worker threads.
 			inline CoRoutineThreadPool() : threadCount(ThreadWrapper::hardware_concurrency()) {
+				std::unique_lock lock{ workerAccessMutex };
 				for (uint32_t x = 0; x < threadCount; ++x) {
 					UniquePtr<WorkerThread> workerThread{ makeUnique<WorkerThread>() };
 					currentIndex.store(currentIndex.load() + 1);
@@ -77,13 +78,11 @@ namespace DiscordCoreAPI {
 			/// @brief Submit a coroutine task to the thread pool.
 			/// @param coro The coroutine handle to submit.
 			inline void submitTask(std::coroutine_handle<> coro) {
-				bool areWeAllBusy{ true };
 				uint64_t currentLowestValue{ std::numeric_limits<uint64_t>::max() };
 				uint64_t currentLowestIndex{ std::numeric_limits<uint64_t>::max() };
 				std::shared_lock lock01{ workerAccessMutex };
 				for (auto& [key, value]: workerThreads) {
 					if (!value->areWeCurrentlyWorking.load()) {
-						areWeAllBusy = false;
 						if (value->tasks.size() < currentLowestValue) {
 							currentLowestValue = value->tasks.size();
 							currentLowestIndex = key;
@@ -91,21 +90,20 @@ namespace DiscordCoreAPI {
 						break;
 					}
 				}
-				if (areWeAllBusy) {
-					UniquePtr<WorkerThread> workerThread{ makeUnique<WorkerThread>() };
-					currentIndex.store(currentIndex.load() + 1);
-					currentCount.store(currentCount.load() + 1);
-					uint64_t indexNew = currentIndex.load();
-					workerThread->thread = ThreadWrapper([=, this](StopToken stopToken) {
-						threadFunction(stopToken, indexNew);
-					});
-					lock01.unlock();
-					std::unique_lock lock02{ workerAccessMutex };
-					workerThreads.emplace(currentIndex.load(), std::move(workerThread));
-					lock02.unlock();
-				} else {
-					workerThreads[currentLowestIndex]->tasks.send(std::move(coro));
+				if (currentLowestIndex != std::numeric_limits<uint64_t>::max() && workerThreads[currentLowestIndex]->tasks.trySend(coro)) {
+					return;
 				}
+				lock01.unlock();
+				UniquePtr<WorkerThread> workerThread{ makeUnique<WorkerThread>() };
+				workerThread->tasks.trySend(coro);
+				std::unique_lock lock02{ workerAccessMutex };
+				currentIndex.store(currentIndex.load() + 1);
+				currentCount.store(currentCount.load() + 1);
+				uint64_t indexNew = currentIndex.load();
+				workerThread->thread = ThreadWrapper([=, this](StopToken stopToken) {
+					threadFunction(stopToken, indexNew);
+				});
+				workerThreads.emplace(indexNew, std::move(workerThread));
 			}
 
 		  protected:
@@ -115,45 +113,39 @@ namespace DiscordCoreAPI {
 			std::atomic_uint64_t currentIndex{};///< Current index of worker threads.
 			const uint64_t threadCount{};///< Total thread count.
 
-			/// @brief Thread function for each worker thread.
+			/// @brief Thread function for each worker thread - parks on its task queue rather than polling it.
 			/// @param stopToken The stop token for the thread.
 			/// @param index The index of the worker thread.
 			inline void threadFunction(StopToken stopToken, uint64_t index) {
+				std::shared_lock lock01{ workerAccessMutex };
+				WorkerThread* workerThread{ workerThreads[index].get() };
+				lock01.unlock();
 				while (!stopToken.stopRequested()) {
-					if (!workerThreads.contains(index)) {
-						return;
-					}
 					std::coroutine_handle<> coroHandle{};
-					if (workerThreads[index]->tasks.tryReceive(coroHandle)) {
-						workerThreads[index]->areWeCurrentlyWorking.store(true);
+					if (workerThread->tasks.receiveFor(coroHandle, 100ms)) {
+						workerThread->areWeCurrentlyWorking.store(true);
 						try {
 							coroHandle();
 						} catch (const DCAException& error) {
 							MessagePrinter::printError<PrintMessageType::General>(error.what());
+						} catch (const std::exception& error) {
+							MessagePrinter::printError<PrintMessageType::General>(error.what());
+						} catch (...) {
+							MessagePrinter::printError<PrintMessageType::General>("CoRoutineThreadPool task threw an unknown exception.");
 						}
-						if (!workerThreads.contains(index)) {
-							return;
-						}
-						workerThreads[index]->areWeCurrentlyWorking.store(false);
+						workerThread->areWeCurrentlyWorking.store(false);
 					}
 					if (currentCount.load() > threadCount) {
-						uint64_t extraWorkers{ currentCount.load() - threadCount };
-						while (extraWorkers > 0) {
-							--extraWorkers;
-							std::unique_lock lock{ workerAccessMutex };
-							auto oldThread = workerThreads.begin();
-							if (oldThread.operator*().second->thread.joinable()) {
-								oldThread.operator*().second->thread.requestStop();
-								oldThread.operator*().second->thread.detach();
-								currentCount.store(currentCount.load() - 1);
-								workerThreads.erase(oldThread.operator*().first);
-							}
+						std::unique_lock lock02{ workerAccessMutex };
+						if (currentCount.load() > threadCount && workerThread->tasks.size() == 0) {
+							workerThread->thread.detach();
+							currentCount.store(currentCount.load() - 1);
+							workerThreads.erase(index);
+							return;
 						}
 					}
-					std::this_thread::sleep_for(100000ns);
 				}
 			}
-
 		};
 		/**@}*/
 	}
@@ -0,0 +1,251 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// CollectorRegistry.hpp - Header file for the "CollectorRegistry" stuff.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file CollectorRegistry.hpp
+
+#pragma once
+
+#include <discordcoreapi/Utilities/Base.hpp>
+#include <discordcoreapi/Utilities/UnorderedMap.hpp>
+#include <discordcoreapi/CoRoutine.hpp>
+
+namespace DiscordCoreAPI {
+
+	namespace DiscordCoreInternal {
+
+		/**
+		 * \addtogroup utilities
+		 * @{
+		 */
+
+		/// @brief The buffer that a collector receives its objects on - a CoRoutine can await the next object without holding onto a thread,
+		/// and is resumed on the thread pool once an object is sent or its wait times out.
+		/// @tparam ValueType The type of object being collected.
+		template<typename ValueType> class CollectorBuffer {
+		  protected:
+			struct BufferState {
+				std::coroutine_handle<> waitingHandle{};
+				std::deque<ValueType> objects{};
+				std::mutex accessMutex{};
+				bool isItStopped{};
+				uint64_t waitId{};
+				uint64_t timerId{};
+			};
+
+		  public:
+			/// @brief An awaitable that yields true and the next object, or false if the wait timed out first.
+			class ReceiveAwaiter {
+			  public:
+				inline ReceiveAwaiter(std::shared_ptr<BufferState> stateNew, ValueType& objectNew, Milliseconds timeOutNew)
+					: state{ std::move(stateNew) }, timeOut{ timeOutNew }, object{ objectNew } {};
+
+				inline bool await_ready() {
+					std::unique_lock lock{ state->accessMutex };
+					return state->objects.size() > 0 || state->isItStopped || timeOut.count() <= 0;
+				}
+
+				inline bool await_suspend(std::coroutine_handle<> coroHandleNew) {
+					std::unique_lock lock{ state->accessMutex };
+					if (state->objects.size() > 0 || state->isItStopped) {
+						return false;
+					}
+					state->waitingHandle = coroHandleNew;
+					uint64_t waitId{ ++state->waitId };
+					state->timerId = NewThreadAwaiterBase::timerWheel.schedule(timeOut, [=, stateNew = state]() {
+						std::unique_lock lockNew{ stateNew->accessMutex };
+						if (stateNew->waitId == waitId && stateNew->waitingHandle) {
+							stateNew->waitingHandle = nullptr;
+							lockNew.unlock();
+							NewThreadAwaiterBase::threadPool.submitTask(coroHandleNew);
+						}
+					});
+					return true;
+				}
+
+				inline bool await_resume() {
+					std::unique_lock lock{ state->accessMutex };
+					if (state->objects.size() > 0) {
+						object = std::move(state->objects.front());
+						state->objects.pop_front();
+						return true;
+					}
+					return false;
+				}
+
+			  protected:
+				std::shared_ptr<BufferState> state{};
+				Milliseconds timeOut{};
+				ValueType& object;
+			};
+
+			inline CollectorBuffer() = default;
+
+			/// @brief Sends an object to the buffer, resuming the CoRoutine that is waiting on it, if there is one.
+			/// @param object The object to send.
+			inline void send(const ValueType& object) {
+				std::unique_lock lock{ state->accessMutex };
+				state->objects.emplace_back(object);
+				if (state->waitingHandle) {
+					std::coroutine_handle<> coroHandle{ std::exchange(state->waitingHandle, nullptr) };
+					uint64_t timerId{ state->timerId };
+					lock.unlock();
+					NewThreadAwaiterBase::timerWheel.cancel(timerId);
+					NewThreadAwaiterBase::threadPool.submitTask(coroHandle);
+				}
+			}
+
+			/// @brief Resumes the CoRoutine that is waiting on the buffer, if there is one, and makes every later receive yield false straight
+			/// away - for cancelling a collector without waiting out its timeout.
+			inline void stop() {
+				std::unique_lock lock{ state->accessMutex };
+				state->isItStopped = true;
+				if (state->waitingHandle) {
+					std::coroutine_handle<> coroHandle{ std::exchange(state->waitingHandle, nullptr) };
+					uint64_t timerId{ state->timerId };
+					lock.unlock();
+					NewThreadAwaiterBase::timerWheel.cancel(timerId);
+					NewThreadAwaiterBase::threadPool.submitTask(coroHandle);
+				}
+			}
+
+			/// @brief Waits for the next object - only one CoRoutine may be waiting on a buffer at once.
+			/// @param object The object to receive into.
+			/// @param timeOut The maximum amount of time to wait for.
+			/// @return ReceiveAwaiter An awaitable that yields true if an object was received, or false if the wait timed out.
+			inline ReceiveAwaiter receive(ValueType& object, Milliseconds timeOut) {
+				return ReceiveAwaiter{ state, object, timeOut };
+			}
+
+		  protected:
+			std::shared_ptr<BufferState> state{ std::make_shared<BufferState>() };
+		};
+
+		/// @brief A thread-safe, indexed registry of the active collectors for one type of object.
+		/// @details Collectors are indexed on a (channel id, message id) key, where a zero id matches any id, and may also be filtered on a user id.
+		/// Delivering an object only visits the collectors under the keys that it could match, so the cost of a delivery scales with the number
+		/// of matching collectors rather than with the total number of collectors.
+		/// @tparam ValueType The type of object being collected.
+		template<typename ValueType> class CollectorRegistry {
+		  public:
+			/// @brief A registered collector.
+			struct CollectorEntry {
+				CollectorBuffer<ValueType>* buffer{};///< The buffer that the collector receives its objects on.
+				uint64_t collectorId{};///< The id that the collector was registered under.
+				Snowflake userId{};///< The user id to filter on, or 0 for any user.
+			};
+
+			inline CollectorRegistry() = default;
+
+			/// @brief Registers a collector.
+			/// @param buffer The buffer to deliver the collector's objects to - it must stay alive until the collector is erased.
+			/// @param channelId The channel id to filter on, or 0 for any channel.
+			/// @param messageId The message id to filter on, or 0 for any message.
+			/// @param userId The user id to filter on, or 0 for any user.
+			/// @return uint64_t The id of the collector, for erasing it later.
+			inline uint64_t add(CollectorBuffer<ValueType>* buffer, Snowflake channelId = Snowflake{}, Snowflake messageId = Snowflake{},
+				Snowflake userId = Snowflake{}) {
+				std::unique_lock lock{ accessMutex };
+				uint64_t collectorId{ ++currentId };
+				TwoIdKey key{ channelId, messageId };
+				collectors[key].emplace_back(CollectorEntry{ buffer, collectorId, userId });
+				collectorKeys[collectorId] = key;
+				collectorCount.store(collectorKeys.size(), std::memory_order_release);
+				return collectorId;
+			}
+
+			/// @brief Unregisters a collector - erasing an id that is no longer registered does nothing.
+			/// @param collectorId The id that the collector was registered under.
+			inline void erase(uint64_t collectorId) {
+				std::unique_lock lock{ accessMutex };
+				if (!collectorKeys.contains(collectorId)) {
+					return;
+				}
+				TwoIdKey key{ collectorKeys[collectorId] };
+				collectorKeys.erase(collectorId);
+				auto& entries = collectors[key];
+				for (uint64_t x = 0; x < entries.size(); ++x) {
+					if (entries[x].collectorId == collectorId) {
+						entries.erase(entries.begin() + static_cast<std::ptrdiff_t>(x));
+						break;
+					}
+				}
+				if (entries.size() == 0) {
+					collectors.erase(key);
+				}
+				collectorCount.store(collectorKeys.size(), std::memory_order_release);
+			}
+
+			/// @brief Delivers an object to each of the collectors whose filters it matches.
+			/// @param value The object to deliver.
+			/// @param channelId The id of the channel that the object belongs to.
+			/// @param messageId The id of the message that the object belongs to.
+			/// @param userId The id of the user that the object belongs to.
+			/// @return bool True if at least one collector received the object.
+			inline bool deliver(const ValueType& value, Snowflake channelId, Snowflake messageId, Snowflake userId) {
+				if (collectorCount.load(std::memory_order_acquire) == 0) {
+					return false;
+				}
+				TwoIdKey keys[4]{ { channelId, messageId }, { channelId, Snowflake{} }, { Snowflake{}, messageId }, { Snowflake{}, Snowflake{} } };
+				bool returnValue{};
+				std::shared_lock lock{ accessMutex };
+				for (uint64_t x = 0; x < std::size(keys); ++x) {
+					if (std::find(keys, keys + x, keys[x]) != keys + x) {
+						continue;
+					}
+					auto iterator = collectors.find(keys[x]);
+					if (iterator == collectors.end()) {
+						continue;
+					}
+					for (auto& value02: iterator->second) {
+						if (value02.userId == 0 || value02.userId == userId) {
+							value02.buffer->send(value);
+							returnValue = true;
+						}
+					}
+				}
+				return returnValue;
+			}
+
+			/// @brief Collects the number of registered collectors.
+			/// @return uint64_t The number of collectors.
+			inline uint64_t size() const {
+				return collectorCount.load(std::memory_order_acquire);
+			}
+
+		  protected:
+			UnorderedMap<TwoIdKey, Jsonifier::Vector<CollectorEntry>> collectors{};
+			UnorderedMap<uint64_t, TwoIdKey> collectorKeys{};
+			std::atomic_uint64_t collectorCount{};
+			std::shared_mutex accessMutex{};
+			uint64_t currentId{};
+		};
+
+		/**@}*/
+
+	}
+}
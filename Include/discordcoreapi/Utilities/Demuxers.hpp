@@ -44,8 +44,17 @@ namespace DiscordCoreAPI {
 		*/
 
 		static constexpr uint32_t SEGMENT_ID{ 0x18538067 };
+		static constexpr uint32_t CLUSTER_ID{ 0x1F43B675 };
+		static constexpr uint32_t TRACKS_ID{ 0x1654AE6B };
+		static constexpr uint32_t TRACK_ENTRY_ID{ 0xAE };
+		static constexpr uint32_t TRACK_NUMBER_ID{ 0xD7 };
+		static constexpr uint32_t CODEC_ID{ 0x86 };
+		static constexpr uint32_t BLOCK_GROUP_ID{ 0xA0 };
+		static constexpr uint32_t BLOCK_ID{ 0xA1 };
 		static constexpr uint8_t SIMPLEBLOCK_ID{ 0xA3 };
-		static constexpr uint8_t OPUS_TRACK_ID{ 0x81 };
+		static constexpr uint64_t DEFAULT_OPUS_TRACK_NUMBER{ 1 };
+		static constexpr uint64_t MAX_BLOCK_SIZE{ 1024 * 1024 };
+		static constexpr uint64_t EBML_UNKNOWN_SIZE{ static_cast<uint64_t>(-1) };
 
 		static constexpr uint8_t ffLog2Tab[]{ 0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5,
 			5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
@@ -54,86 +63,155 @@ namespace DiscordCoreAPI {
 			7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
 			7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7 };
 
-		/// @brief A class for demuxing Matroska-contained audio data.
+		/// @brief The result of attempting to read an EBML variable-length integer.
+		enum class EbmlReadStatus { Success = 0, Need_More_Data = 1, Invalid = 2 };
+
+		/// @brief A span of a demuxed frame, relative to the demuxer's internal buffer.
+		struct DemuxedFrameSpan {
+			uint64_t offset{};///< Offset of the frame within the buffer.
+			uint64_t length{};///< Length of the frame.
+		};
+
+		/// @brief A class for incrementally demuxing Matroska/WebM-contained Opus audio data.
+		/// @details Elements are parsed by their declared sizes, so the parser resumes across buffer boundaries without ever rescanning
+		/// data that it has already consumed. Frames are yielded as views into the demuxer's own buffer, which is compacted and reused on
+		/// each write.
 		class MatroskaDemuxer {
 		  public:
 			/// @brief Constructor for MatroskaDemuxer.
 			inline MatroskaDemuxer() = default;
 
-			/// @brief Writes data to the Matroska demuxer.
-			/// @param dataNew The data to be written.
+			/// @brief Appends data to the Matroska demuxer.
+			/// @details Frame views returned by collectFrame() are invalidated by this call.
+			/// @param dataNew The data to be appended.
 			inline void writeData(std::basic_string_view<uint8_t> dataNew) {
-				data = dataNew;
+				uint64_t discardLength{ currentPosition };
+				if (frameSpans.size() > 0) {
+					discardLength = std::min(discardLength, frameSpans.front().offset);
+				}
+				if (discardLength > 0) {
+					data.erase(0, discardLength);
+					currentPosition -= discardLength;
+					discardedBytes += discardLength;
+					for (auto& value: frameSpans) {
+						value.offset -= discardLength;
+					}
+				}
+				data.append(dataNew);
 			}
 
-			/// @brief Collects the next frame from the demuxer.
+			/// @brief Collects the next frame from the demuxer, without copying it.
+			/// @param frameNew The reference to store the view of the collected frame, valid until the next call to writeData().
+			/// @return True if a frame was collected, false otherwise.
+			inline bool collectFrame(std::basic_string_view<uint8_t>& frameNew) {
+				if (frameSpans.size() > 0) {
+					frameNew = std::basic_string_view<uint8_t>{ data.data() + frameSpans.front().offset, frameSpans.front().length };
+					frameSpans.pop_front();
+					return true;
+				} else {
+					return false;
+				}
+			}
+
+			/// @brief Collects the next frame from the demuxer, reusing the frame's existing storage.
 			/// @param frameNew The reference to store the collected frame.
 			/// @return True if a frame was collected, false otherwise.
 			inline bool collectFrame(AudioFrameData& frameNew) {
-				if (frames.size() > 0) {
-					frameNew = std::move(frames.at(0));
-					frames.erase(frames.begin());
+				std::basic_string_view<uint8_t> frameView{};
+				if (collectFrame(frameView)) {
+					frameNew += frameView;
+					frameNew.type = AudioFrameType::Encoded;
 					return true;
 				} else {
 					return false;
 				}
 			}
 
-			/// @brief Proceed with the demuxing process.
+			/// @brief Proceeds with the demuxing process, consuming every complete element that is currently buffered.
 			inline void proceedDemuxing() {
-				if (!doWeHaveTotalSize) {
-					if (reverseBytes<uint32_t>() != SEGMENT_ID) {
-						MessagePrinter::printError<PrintMessageType::General>(
-							"Missing a Segment, which was expected at index: " + std::to_string(currentPosition) + std::string{ "..." });
-						if (!findNextId(SEGMENT_ID)) {
-							if ((totalSize > 0 && currentPosition >= totalSize)) {
-								areWeDoneVal = true;
-							}
+				while (!areWeDoneVal) {
+					if (areWeResynchronizing && !findNextCluster()) {
+						return;
+					}
+					if (bytesToSkip > 0) {
+						uint64_t skipLength{ std::min(bytesToSkip, static_cast<uint64_t>(data.size()) - currentPosition) };
+						currentPosition += skipLength;
+						bytesToSkip -= skipLength;
+						if (bytesToSkip > 0) {
 							return;
 						}
-						MessagePrinter::printSuccess<PrintMessageType::General>(
-							"Missing Segment, found at index: " + std::to_string(currentPosition) + ".");
-					} else {
-						currentPosition += sizeof(uint32_t);
 					}
-					totalSize = collectElementSize();
-					doWeHaveTotalSize = true;
-				}
-				while (currentPosition + 3 < data.size() && data.find(0xa3) != std::string::npos) {
-					if (currentPosition >= data.size() - 8) {
-						if ((totalSize > 0 && currentPosition >= totalSize)) {
-							areWeDoneVal = true;
-						}
+					if (segmentEnd != EBML_UNKNOWN_SIZE && getStreamPosition() >= segmentEnd) {
+						areWeDoneVal = true;
+						return;
+					}
+					uint64_t elementId{}, idLength{}, elementSize{}, sizeLength{};
+					EbmlReadStatus status{ readVint(currentPosition, true, elementId, idLength) };
+					if (status == EbmlReadStatus::Success) {
+						status = idLength > 4 ? EbmlReadStatus::Invalid : readVint(currentPosition + idLength, false, elementSize, sizeLength);
+					}
+					if (status == EbmlReadStatus::Need_More_Data) {
 						return;
+					} else if (status == EbmlReadStatus::Invalid) {
+						resynchronize();
+						continue;
 					}
-					if (data.at(currentPosition) == SIMPLEBLOCK_ID &&
-						((data.at(currentPosition + 2) == OPUS_TRACK_ID || data.at(currentPosition + 3) == OPUS_TRACK_ID))) {
-						++currentPosition;
-						if (currentSize == 0) {
-							currentSize = collectElementSize();
-							if (currentSize >= totalSize || currentSize >= 1276 || currentSize < 4) {
-								++currentPosition;
-								currentSize = 0;
+					uint64_t headerLength{ idLength + sizeLength };
+					switch (elementId) {
+						case SEGMENT_ID: {
+							segmentEnd = elementSize == EBML_UNKNOWN_SIZE ? EBML_UNKNOWN_SIZE : getStreamPosition() + headerLength + elementSize;
+							currentPosition += headerLength;
+							break;
+						}
+						case TRACK_ENTRY_ID: {
+							currentTrackNumber = 0;
+							isCurrentTrackOpus = false;
+							currentPosition += headerLength;
+							break;
+						}
+						case CLUSTER_ID:
+							[[fallthrough]];
+						case TRACKS_ID:
+							[[fallthrough]];
+						case BLOCK_GROUP_ID: {
+							currentPosition += headerLength;
+							break;
+						}
+						case TRACK_NUMBER_ID:
+							[[fallthrough]];
+						case CODEC_ID:
+							[[fallthrough]];
+						case BLOCK_ID:
+							[[fallthrough]];
+						case SIMPLEBLOCK_ID: {
+							if (elementSize == EBML_UNKNOWN_SIZE || elementSize > MAX_BLOCK_SIZE) {
+								resynchronize();
 								continue;
-							} else if (currentSize == static_cast<uint64_t>(-1) || currentPosition + currentSize >= data.size()) {
-								if ((totalSize > 0 && currentPosition >= totalSize)) {
-									areWeDoneVal = true;
-								}
+							}
+							if (currentPosition + headerLength + elementSize > data.size()) {
 								return;
+							}
+							if (elementId == TRACK_NUMBER_ID) {
+								parseTrackNumber(currentPosition + headerLength, elementSize);
+							} else if (elementId == CODEC_ID) {
+								parseCodecId(currentPosition + headerLength, elementSize);
 							} else {
-								parseOpusFrame();
+								parseBlock(currentPosition + headerLength, elementSize);
 							}
-						} else {
-							currentSize = 0;
+							currentPosition += headerLength + elementSize;
+							break;
+						}
+						default: {
+							if (elementSize == EBML_UNKNOWN_SIZE) {
+								resynchronize();
+								continue;
+							}
+							currentPosition += headerLength;
+							bytesToSkip = elementSize;
+							break;
 						}
-					} else {
-						++currentPosition;
 					}
 				}
-				if ((totalSize > 0 && currentPosition >= totalSize)) {
-					areWeDoneVal = true;
-				}
-				return;
 			}
 
 			/// @brief Checks if the demuxing process is complete.
@@ -143,79 +221,182 @@ namespace DiscordCoreAPI {
 			}
 
 		  protected:
-			std::basic_string_view<uint8_t> data{};///< Input data for demuxing.
-			std::deque<AudioFrameData> frames{};///< Queue to store collected frames.
-			bool doWeHaveTotalSize{ false };///< Flag indicating if total size has been determined.
+			uint64_t opusTrackNumber{ DEFAULT_OPUS_TRACK_NUMBER };///< The track number carrying the Opus stream.
+			uint64_t segmentEnd{ EBML_UNKNOWN_SIZE };///< Absolute stream offset at which the Segment ends.
+			std::deque<DemuxedFrameSpan> frameSpans{};///< Spans of the frames that have not yet been collected.
+			std::basic_string<uint8_t> data{};///< Unconsumed input data for demuxing.
+			uint64_t currentTrackNumber{};///< Track number of the TrackEntry being parsed.
+			bool isCurrentTrackOpus{ false };///< Whether the TrackEntry being parsed is an Opus track.
+			bool areWeResynchronizing{ false };///< Whether the parser is searching for the next Cluster.
 			bool areWeDoneVal{ false };///< Flag indicating if demuxing is complete.
 			uint64_t currentPosition{};///< Current position in the data.
-			uint64_t currentSize{};///< Current size of the element being processed.
-			uint64_t totalSize{};///< Total size of the segment.
-
-			/// @brief Finds the next occurrence of the specified value in the data.
-			/// @tparam ObjectType The type of value to search for.
-			/// @param value The value to search for.
-			/// @return True if the value was found, false otherwise.
-			template<typename ObjectType> inline bool findNextId(ObjectType value) {
-				if (currentPosition + sizeof(ObjectType) >= data.size()) {
-					return false;
+			uint64_t discardedBytes{};///< Number of bytes already discarded from the front of the data.
+			uint64_t bytesToSkip{};///< Remaining payload bytes of a skipped element.
+
+			/// @brief Gets the absolute position of the parser within the stream.
+			/// @return The absolute stream offset.
+			inline uint64_t getStreamPosition() {
+				return discardedBytes + currentPosition;
+			}
+
+			/// @brief Reads an EBML variable-length integer.
+			/// @param position The position of the integer within the data.
+			/// @param keepMarker Whether to retain the length marker bit, as is done for element ids.
+			/// @param value The reference to store the integer's value in.
+			/// @param length The reference to store the integer's length in.
+			/// @return The status of the read.
+			inline EbmlReadStatus readVint(uint64_t position, bool keepMarker, uint64_t& value, uint64_t& length) {
+				if (position >= data.size()) {
+					return EbmlReadStatus::Need_More_Data;
+				}
+				uint8_t firstByte{ data[position] };
+				if (firstByte == 0) {
+					return EbmlReadStatus::Invalid;
 				}
-				while (currentPosition + sizeof(ObjectType) < data.size()) {
-					if (reverseBytes<ObjectType>() == value) {
-						currentPosition += sizeof(ObjectType);
+				length = 8ull - ffLog2Tab[firstByte];
+				if (position + length > data.size()) {
+					return EbmlReadStatus::Need_More_Data;
+				}
+				value = keepMarker ? firstByte : firstByte ^ (1ull << ffLog2Tab[firstByte]);
+				bool areAllBitsSet{ value == (1ull << ffLog2Tab[firstByte]) - 1ull };
+				for (uint64_t x = 1; x < length; ++x) {
+					areAllBitsSet = areAllBitsSet && data[position + x] == 0xFF;
+					value = (value << 8) | data[position + x];
+				}
+				if (!keepMarker && areAllBitsSet) {
+					value = EBML_UNKNOWN_SIZE;
+				}
+				return EbmlReadStatus::Success;
+			}
+
+			/// @brief Begins skipping forward to the next Cluster, after encountering a malformed element.
+			inline void resynchronize() {
+				MessagePrinter::printError<PrintMessageType::General>(
+					"Invalid EBML element at index: " + std::to_string(getStreamPosition()) + ", resynchronizing at the next Cluster...");
+				areWeResynchronizing = true;
+				bytesToSkip = 0;
+				++currentPosition;
+			}
+
+			/// @brief Searches the buffered data for the next Cluster.
+			/// @return True if a Cluster was found, false if more data is required.
+			inline bool findNextCluster() {
+				for (uint64_t x = currentPosition; x + sizeof(uint32_t) <= data.size(); ++x) {
+					if (data[x] == 0x1F && data[x + 1] == 0x43 && data[x + 2] == 0xB6 && data[x + 3] == 0x75) {
+						currentPosition = x;
+						areWeResynchronizing = false;
 						return true;
 					}
-					++currentPosition;
 				}
+				currentPosition = std::max(currentPosition, static_cast<uint64_t>(data.size()) - std::min<uint64_t>(data.size(), 3));
 				return false;
 			}
 
-			/// @brief Reverses the byte order of the current element being processed.
-			/// @tparam ObjectType The type of the current element.
-			/// @return The current element with reversed byte order.
-			template<typename ObjectType> inline ObjectType reverseBytes() {
-				if (data.size() <= currentPosition + sizeof(ObjectType)) {
-					return static_cast<ObjectType>(-1);
+			/// @brief Parses the TrackNumber of the current TrackEntry.
+			/// @param position The position of the element's payload.
+			/// @param size The size of the element's payload.
+			inline void parseTrackNumber(uint64_t position, uint64_t size) {
+				currentTrackNumber = 0;
+				for (uint64_t x = 0; x < size && x < sizeof(uint64_t); ++x) {
+					currentTrackNumber = (currentTrackNumber << 8) | data[position + x];
+				}
+				if (isCurrentTrackOpus) {
+					opusTrackNumber = currentTrackNumber;
 				}
-				ObjectType newValue{};
-				std::memcpy(&newValue, &data.at(currentPosition), sizeof(ObjectType));
-				newValue = reverseByteOrder(newValue);
-				return newValue;
 			}
 
-			/// @brief Collects the size of the current element being processed.
-			/// @return The size of the current element.
-			inline int64_t collectElementSize() {
-				if (currentPosition >= data.size() - 8) {
-					return -1;
+			/// @brief Parses the CodecID of the current TrackEntry.
+			/// @param position The position of the element's payload.
+			/// @param size The size of the element's payload.
+			inline void parseCodecId(uint64_t position, uint64_t size) {
+				static constexpr std::string_view opusCodecId{ "A_OPUS" };
+				isCurrentTrackOpus = size >= opusCodecId.size() && std::memcmp(data.data() + position, opusCodecId.data(), opusCodecId.size()) == 0;
+				if (isCurrentTrackOpus && currentTrackNumber != 0) {
+					opusTrackNumber = currentTrackNumber;
 				}
-				return collectNumber();
 			}
 
-			/// @brief Collects a number from the data.
-			/// @return The collected number.
-			inline int64_t collectNumber() {
-				int32_t read{}, n{ 1 };
-				uint64_t total{};
-				total = static_cast<uint8_t>(data.at(currentPosition++));
-
-				read = 8 - ffLog2Tab[total];
-
-				total ^= 1ull << ffLog2Tab[total];
-				while (n++ < read) {
-					total = (total << 8) | static_cast<uint8_t>(data.at(currentPosition++));
+			/// @brief Parses a Block or SimpleBlock, recording the span of each of its Opus frames.
+			/// @param position The position of the element's payload.
+			/// @param size The size of the element's payload.
+			inline void parseBlock(uint64_t position, uint64_t size) {
+				uint64_t trackNumber{}, trackNumberLength{};
+				uint64_t endPosition{ position + size };
+				if (readVint(position, false, trackNumber, trackNumberLength) != EbmlReadStatus::Success || trackNumber != opusTrackNumber ||
+					position + trackNumberLength + 3 > endPosition) {
+					return;
+				}
+				position += trackNumberLength + 2;
+				uint8_t lacingType{ static_cast<uint8_t>((data[position++] >> 1) & 0x03) };
+				if (lacingType == 0) {
+					emplaceFrame(position, endPosition - position);
+					return;
+				}
+				if (position >= endPosition) {
+					return;
+				}
+				uint64_t frameCount{ static_cast<uint64_t>(data[position++]) + 1ull };
+				std::array<uint64_t, 256> frameSizes{};
+				uint64_t lacedSize{};
+				if (lacingType == 1) {
+					for (uint64_t x = 0; x < frameCount - 1; ++x) {
+						uint8_t sizeByte{ 0xFF };
+						while (sizeByte == 0xFF) {
+							if (position >= endPosition) {
+								return;
+							}
+							sizeByte = data[position++];
+							frameSizes[x] += sizeByte;
+						}
+						lacedSize += frameSizes[x];
+					}
+				} else if (lacingType == 3) {
+					uint64_t sizeLength{};
+					if (readVint(position, false, frameSizes[0], sizeLength) != EbmlReadStatus::Success || frameSizes[0] == EBML_UNKNOWN_SIZE) {
+						return;
+					}
+					position += sizeLength;
+					lacedSize = frameSizes[0];
+					for (uint64_t x = 1; x < frameCount - 1; ++x) {
+						uint64_t rawDifference{};
+						if (readVint(position, false, rawDifference, sizeLength) != EbmlReadStatus::Success) {
+							return;
+						}
+						position += sizeLength;
+						int64_t difference{ static_cast<int64_t>(rawDifference) - ((1ll << (7 * sizeLength - 1)) - 1) };
+						int64_t frameSize{ static_cast<int64_t>(frameSizes[x - 1]) + difference };
+						if (frameSize < 0) {
+							return;
+						}
+						frameSizes[x] = static_cast<uint64_t>(frameSize);
+						lacedSize += frameSizes[x];
+					}
+				} else {
+					if (position > endPosition) {
+						return;
+					}
+					for (uint64_t x = 0; x < frameCount - 1; ++x) {
+						frameSizes[x] = (endPosition - position) / frameCount;
+						lacedSize += frameSizes[x];
+					}
+				}
+				if (position > endPosition || position + lacedSize > endPosition) {
+					return;
+				}
+				frameSizes[frameCount - 1] = endPosition - position - lacedSize;
+				for (uint64_t x = 0; x < frameCount; ++x) {
+					emplaceFrame(position, frameSizes[x]);
+					position += frameSizes[x];
 				}
-				return static_cast<int64_t>(total);
 			}
 
-			/// @brief Parses an Opus frame.
-			inline void parseOpusFrame() {
-				AudioFrameData frameNew{};
-				frameNew.currentSize = currentSize - 4;
-				frameNew += std::basic_string_view<uint8_t>{ data.data() + currentPosition + 4, static_cast<uint64_t>(frameNew.currentSize) };
-				frameNew.type = AudioFrameType::Encoded;
-				currentPosition += currentSize;
-				frames.emplace_back(std::move(frameNew));
-				currentSize = 0;
+			/// @brief Records the span of a single Opus frame.
+			/// @param position The position of the frame.
+			/// @param length The length of the frame.
+			inline void emplaceFrame(uint64_t position, uint64_t length) {
+				if (length > 0) {
+					frameSpans.emplace_back(DemuxedFrameSpan{ position, length });
+				}
 			}
 		};
 
@@ -321,13 +502,17 @@ namespace DiscordCoreAPI {
 		  public:
 			inline OggDemuxer() = default;
 
-			/// @brief Collects the next audio frame from the demuxer.
+			/// @brief Collects the next audio frame from the demuxer, reusing the frame's existing storage.
 			/// @param frameNew The reference to store the collected frame.
 			/// @return True if a frame was collected, false otherwise.
 			inline bool collectFrame(AudioFrameData& frameNew) {
-				if (frames.size() > 0) {
-					frameNew = std::move(frames.front());
-					frames.pop_front();
+				if (frameSpans.size() > 0) {
+					frameNew += std::basic_string_view<uint8_t>{ frameData.data() + frameSpans.front().offset, frameSpans.front().length };
+					frameNew.type = AudioFrameType::Encoded;
+					frameSpans.pop_front();
+					if (frameSpans.empty()) {
+						frameData.clear();
+					}
 					return true;
 				} else {
 					return false;
@@ -384,7 +569,8 @@ namespace DiscordCoreAPI {
 			}
 
 		  protected:
-			std::deque<AudioFrameData> frames{};///< Queue to store collected audio frames.
+			std::deque<DemuxedFrameSpan> frameSpans{};///< Spans of the frames that have not yet been collected.
+			std::basic_string<uint8_t> frameData{};///< The frames that have not yet been collected, back to back - its storage is reused.
 			std::deque<OpusPacket> packets{};///< Queue to store Opus packets.
 			LightString<uint8_t> data{};///< Input data for demuxing.
 			std::deque<OggPage> pages{};///< Queue to store Ogg pages.
@@ -405,29 +591,135 @@ namespace DiscordCoreAPI {
 			/// @brief Processes Opus packets extracted from Ogg pages.
 			inline void processPackets() {
 				while (!packets.empty()) {
-					OpusPacket newPacket = packets.front();
+					OpusPacket newPacket{ std::move(packets.front()) };
 					packets.pop_front();
-					AudioFrameData newFrame{};
-					newFrame += std::basic_string_view<uint8_t>{ newPacket.data(), newPacket.size() };
-					newFrame.currentSize = newPacket.size();
-					newFrame.type = AudioFrameType::Encoded;
-					frames.emplace_back(std::move(newFrame));
+					if (newPacket.size() == 0 || isItAHeaderPacket(newPacket)) {
+						continue;
+					}
+					frameSpans.emplace_back(DemuxedFrameSpan{ frameData.size(), newPacket.size() });
+					frameData.append(newPacket.data(), newPacket.size());
+				}
+			}
+
+			/// @brief Checks for the OpusHead and OpusTags packets, which carry stream metadata rather than audio.
+			/// @param packet The packet to check.
+			/// @return True if the packet is a header packet, false otherwise.
+			inline bool isItAHeaderPacket(OpusPacket& packet) {
+				static constexpr std::string_view opusHead{ "OpusHead" };
+				static constexpr std::string_view opusTags{ "OpusTags" };
+				if (packet.size() < opusHead.size()) {
+					return false;
 				}
+				std::string_view packetStart{ reinterpret_cast<const char*>(packet.data()), opusHead.size() };
+				return packetStart == opusHead || packetStart == opusTags;
 			}
 
 			/// @brief Processes Ogg pages to extract Opus packets.
 			inline void processPages() {
 				while (!pages.empty()) {
-					OggPage page = pages.front();
+					OggPage page{ std::move(pages.front()) };
 					pages.pop_front();
 					OpusPacket newPacket{};
 					while (page.getOpusPacket(newPacket)) {
-						packets.emplace_back(newPacket);
+						packets.emplace_back(std::move(newPacket));
 					}
 				}
 			}
 		};
 
+		/// @brief A class for splitting RIFF/WAVE or headerless PCM audio into 20ms frames of 48kHz, 16-bit, stereo PCM.
+		class WavDemuxer {
+		  public:
+			static constexpr uint64_t bytesPerFrame{ 48000 / 50 * 2 * sizeof(int16_t) };
+
+			inline WavDemuxer() = default;
+
+			/// @brief Parses the header of a RIFF/WAVE file.
+			/// @param fileData The contents of the file - which must outlive the demuxer.
+			/// @return True if the file holds 48kHz, 16-bit, mono or stereo PCM, false otherwise.
+			inline bool openWav(std::basic_string_view<uint8_t> fileData) {
+				if (fileData.size() < 12 || !matchesTag(fileData, 0, "RIFF") || !matchesTag(fileData, 8, "WAVE")) {
+					MessagePrinter::printError<PrintMessageType::General>("WavDemuxer::openWav() Error: Not a RIFF/WAVE file.");
+					return false;
+				}
+				uint64_t position{ 12 };
+				bool haveWeFoundTheFormat{};
+				while (position + 8 <= fileData.size()) {
+					uint64_t chunkSize{ readLittleEndian<uint32_t>(fileData, position + 4) };
+					uint64_t chunkStart{ position + 8 };
+					if (matchesTag(fileData, position, "fmt ") && chunkStart + 16 <= fileData.size()) {
+						uint16_t formatTag{ readLittleEndian<uint16_t>(fileData, chunkStart) };
+						channelCount = readLittleEndian<uint16_t>(fileData, chunkStart + 2);
+						uint32_t sampleRate{ readLittleEndian<uint32_t>(fileData, chunkStart + 4) };
+						uint16_t bitsPerSample{ readLittleEndian<uint16_t>(fileData, chunkStart + 14) };
+						if (formatTag != 1 || sampleRate != 48000 || bitsPerSample != 16 || (channelCount != 1 && channelCount != 2)) {
+							MessagePrinter::printError<PrintMessageType::General>(
+								"WavDemuxer::openWav() Error: Only 48kHz, 16-bit, mono or stereo PCM is supported.");
+							return false;
+						}
+						haveWeFoundTheFormat = true;
+					} else if (matchesTag(fileData, position, "data") && haveWeFoundTheFormat) {
+						data = fileData.substr(chunkStart, std::min(chunkSize, fileData.size() - chunkStart));
+						currentPosition = 0;
+						return true;
+					}
+					position = chunkStart + chunkSize + (chunkSize & 1);
+				}
+				MessagePrinter::printError<PrintMessageType::General>("WavDemuxer::openWav() Error: No audio data was found.");
+				return false;
+			}
+
+			/// @brief Opens headerless PCM data, which must be 48kHz, 16-bit, little-endian, interleaved stereo.
+			/// @param fileData The contents of the file - which must outlive the demuxer.
+			inline void openRaw(std::basic_string_view<uint8_t> fileData) {
+				data = fileData;
+				channelCount = 2;
+				currentPosition = 0;
+			}
+
+			/// @brief Collects the next 20ms frame, zero-padding the final one.
+			/// @param frameNew The reference to store the collected frame.
+			/// @return True if a frame was collected, false otherwise.
+			inline bool collectFrame(AudioFrameData& frameNew) {
+				uint64_t bytesPerInputFrame{ bytesPerFrame / 2 * channelCount };
+				if (currentPosition >= data.size()) {
+					return false;
+				}
+				auto inputFrame = data.substr(currentPosition, bytesPerInputFrame);
+				currentPosition += inputFrame.size();
+				frameBuffer.assign(bytesPerFrame, 0);
+				if (channelCount == 2) {
+					std::memcpy(frameBuffer.data(), inputFrame.data(), inputFrame.size());
+				} else {
+					for (uint64_t x = 0; x + 1 < inputFrame.size(); x += 2) {
+						std::memcpy(frameBuffer.data() + x * 2, inputFrame.data() + x, 2);
+						std::memcpy(frameBuffer.data() + x * 2 + 2, inputFrame.data() + x, 2);
+					}
+				}
+				frameNew += frameBuffer;
+				frameNew.type = AudioFrameType::RawPCM;
+				return true;
+			}
+
+		  protected:
+			std::basic_string_view<uint8_t> data{};
+			std::basic_string<uint8_t> frameBuffer{};
+			uint64_t currentPosition{};
+			uint16_t channelCount{ 2 };
+
+			inline static bool matchesTag(std::basic_string_view<uint8_t> fileData, uint64_t position, std::string_view tag) {
+				return position + tag.size() <= fileData.size() && std::memcmp(fileData.data() + position, tag.data(), tag.size()) == 0;
+			}
+
+			template<typename ValueType> inline static ValueType readLittleEndian(std::basic_string_view<uint8_t> fileData, uint64_t position) {
+				ValueType returnValue{};
+				for (uint64_t x = 0; x < sizeof(ValueType) && position + x < fileData.size(); ++x) {
+					returnValue |= static_cast<ValueType>(static_cast<ValueType>(fileData[position + x]) << (x * 8));
+				}
+				return returnValue;
+			}
+		};
+
 		/**@}*/
 	}
 }
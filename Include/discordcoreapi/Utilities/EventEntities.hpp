@@ -55,22 +55,76 @@ namespace DiscordCoreAPI {
 			/// @param rhs The right-hand side EventDelegateToken to compare against.
 			/// @return bool True if this EventDelegateToken is less than rhs, otherwise false.
 			inline bool operator<(const EventDelegateToken& rhs) const {
-				return stoull(handlerId) < stoull(rhs.handlerId);
+				return handlerId < rhs.handlerId;
 			}
 
 			/// @brief Default constructor for EventDelegateToken.
 			inline EventDelegateToken() = default;
 
-			std::string handlerId{};///< Identifier for the handler.
-			std::string eventId{};///< Identifier for the event.
+			/// @brief Collects a new, process-wide unique id - for both handlers and events.
+			/// @return uint64_t The id.
+			inline static uint64_t getNextId() {
+				return currentId.fetch_add(1, std::memory_order_relaxed) + 1;
+			}
+
+			uint64_t handlerId{};///< Identifier for the handler.
+			uint64_t eventId{};///< Identifier for the event.
+
+		  protected:
+			inline static std::atomic_uint64_t currentId{};
 		};
 
+		/// @brief How an Event runs its handlers, when it is fired.
+		enum class EventDispatchMode : uint8_t {
+			Synchronous = 0,///< Handlers are run one after another, and the firing thread waits for each of them to complete.
+			Unordered = 1,///< Each handler is run on the coroutine thread pool, and the firing thread does not wait.
+			Per_Guild = 2,///< As Unordered, but the dispatches for any one guild are run one at a time, in the order they were fired.
+			Per_Channel = 3///< As Unordered, but the dispatches for any one channel are run one at a time, in the order they were fired.
+		};
+
+		/// @brief Handler-backlog metrics, for an Event that dispatches asynchronously.
+		struct EventDispatchMetrics {
+			uint64_t totalDispatchedCount{};///< The number of dispatches that have been queued since startup.
+			uint64_t peakPendingCount{};///< The highest number of dispatches that have been queued or running at once.
+			uint64_t activeQueueCount{};///< The number of per-guild or per-channel queues that currently have work in them.
+			uint64_t pendingCount{};///< The number of dispatches that are currently queued or running.
+		};
+
+		/// @brief Runs a function on the coroutine thread pool - defined alongside the pool, in CoRoutine.hpp.
+		/// @param function The function to run.
+		template<typename FunctionType> inline void submitToThreadPool(FunctionType&& function);
+
+		template<typename ValueType> inline uint64_t getOrderingId(const ValueType& value) {
+			if constexpr (std::is_convertible_v<ValueType, uint64_t>) {
+				return static_cast<uint64_t>(value);
+			} else {
+				return value.operator const uint64_t&();
+			}
+		}
+
+		/// @brief Collects the key that an event argument is serialized on, for the Per_Guild and Per_Channel dispatch modes.
+		/// @param dispatchMode The dispatch mode of the event.
+		/// @param arg The event argument.
+		/// @return The guild or channel id - falling back to the guild id for Per_Channel, and to 0 (one shared queue) if neither exists.
+		template<typename ValueType> inline uint64_t getEventOrderingKey(EventDispatchMode dispatchMode, const ValueType& arg) {
+			if constexpr (requires { arg.value.channelId; }) {
+				if (dispatchMode == EventDispatchMode::Per_Channel) {
+					return getOrderingId(arg.value.channelId);
+				}
+			}
+			if constexpr (requires { arg.value.guildId; }) {
+				return getOrderingId(arg.value.guildId);
+			} else {
+				return 0;
+			}
+		}
+
 	};
 
 	template<EventDelegateTokenT ValueType> uint64_t KeyHasher::operator()(const ValueType& data) const {
 		uint64_t dataNew[2]{};
-		dataNew[0] = stoull(data.eventId);
-		dataNew[0] = stoull(data.handlerId);
+		dataNew[0] = data.eventId;
+		dataNew[1] = data.handlerId;
 		return internalHashFunction(dataNew, std::size(dataNew) * sizeof(uint64_t));
 	};
 
@@ -146,27 +200,31 @@ namespace DiscordCoreAPI {
 			std::function<ReturnType(ArgTypes...)> function{};
 		};
 
-		 /// @brief Template class representing an event that executes event functions.
+		/// @brief Template class representing an event that executes event functions.
+		/// @details The handlers are held in a flat, copy-on-write array: adding or removing a handler publishes a new array, and firing the
+		/// event iterates whichever array was current when it started - so dispatch only holds a lock for as long as it takes to copy a pointer.
 		template<typename ReturnType, typename... ArgTypes> class Event {
 		  public:
-			UnorderedMap<EventDelegateToken, EventDelegate<ReturnType, ArgTypes...>> functions;
+			/// @brief A registered handler, along with the token that it was registered under.
+			struct HandlerEntry {
+				std::function<ReturnType(ArgTypes...)> function{};
+				EventDelegateToken token{};
+			};
+
+			using HandlerArray = Jsonifier::Vector<HandlerEntry>;
 
 			/// @brief Move assignment operator for the Event class.
 			/// This operator moves the contents of another Event instance, 'other', into the current instance.
-			/// It transfers the functions and eventId from 'other' to the current instance, clearing 'other' in the process.
+			/// It transfers the handlers and eventId from 'other' to the current instance, clearing 'other' in the process.
 			/// @param other The Event instance to be moved from.
 			/// @return Reference to the current Event instance after the move assignment.
 			Event<ReturnType, ArgTypes...>& operator=(Event<ReturnType, ArgTypes...>&& other) noexcept {
 				if (this != &other) {
-					// Move the functions from 'other' to the current instance.
-					functions = std::move(other.functions);
-					// Clear 'other' functions.
-					other.functions.clear();
-
-					// Move the eventId from 'other' to the current instance.
-					eventId = std::move(other.eventId);
-					// Clear 'other' eventId.
-					other.eventId.clear();
+					std::shared_ptr<const HandlerArray> functionsNew{ other.loadHandlers() };
+					other.storeHandlers(std::make_shared<const HandlerArray>());
+					storeHandlers(std::move(functionsNew));
+					eventId = other.eventId;
+					other.eventId = EventDelegateToken::getNextId();
 				}
 				return *this;
 			}
@@ -181,20 +239,19 @@ namespace DiscordCoreAPI {
 			}
 
 			/// @brief Default constructor for Event class.
-			Event() {
-				std::unique_lock lock{ accessMutex };
-				eventId = std::to_string(std::chrono::duration_cast<Microseconds>(HRClock::now().time_since_epoch()).count());
-			}
+			Event() = default;
 
 			/// @brief Add an event delegate to the event.
 			/// @param eventDelegate The event delegate to add.
-			/// @return EventDelegateToken The token representing the added event delegate.
+			/// @return EventDelegateToken The token representing the added event event.
 			EventDelegateToken add(EventDelegate<ReturnType, ArgTypes...> eventDelegate) {
 				std::unique_lock lock{ accessMutex };
 				EventDelegateToken eventToken{};
-				eventToken.handlerId = std::to_string(std::chrono::duration_cast<Microseconds>(HRClock::now().time_since_epoch()).count());
+				eventToken.handlerId = EventDelegateToken::getNextId();
 				eventToken.eventId = eventId;
-				functions[eventToken] = std::move(eventDelegate);
+				std::shared_ptr<HandlerArray> functionsNew{ std::make_shared<HandlerArray>(*loadHandlers()) };
+				functionsNew->emplace_back(HandlerEntry{ std::move(eventDelegate.function), eventToken });
+				storeHandlers(std::move(functionsNew));
 				return eventToken;
 			}
 
@@ -203,29 +260,183 @@ namespace DiscordCoreAPI {
 			void erase(EventDelegateToken eventToken) {
 				std::unique_lock lock{ accessMutex };
 				if (eventToken.eventId == eventId) {
-					if (functions.contains(eventToken)) {
-						functions.erase(eventToken);
+					std::shared_ptr<HandlerArray> functionsNew{ std::make_shared<HandlerArray>() };
+					for (auto& value: *loadHandlers()) {
+						if (value.token.handlerId != eventToken.handlerId) {
+							functionsNew->emplace_back(value);
+						}
 					}
+					storeHandlers(std::move(functionsNew));
 				}
 			}
 
+			/// @brief Removes every handler from the event.
+			void clear() {
+				std::unique_lock lock{ accessMutex };
+				storeHandlers(std::make_shared<const HandlerArray>());
+			}
+
+			/// @brief Checks whether any handlers are registered - cheap enough to call before building the event's argument.
+			/// @return bool True if there is at least one handler.
+			bool hasListeners() {
+				return loadHandlers()->size() > 0;
+			}
+
+			/// @brief Sets how the event's handlers are run when it is fired.
+			/// @details In any of the asynchronous modes the event must outlive the handlers it has queued.
+			/// @param dispatchModeNew The dispatch mode to use.
+			void setDispatchMode(EventDispatchMode dispatchModeNew) {
+				dispatchMode.store(dispatchModeNew);
+			}
+
+			/// @brief Collects the event's dispatch mode.
+			/// @return EventDispatchMode The dispatch mode.
+			EventDispatchMode getDispatchMode() {
+				return dispatchMode.load();
+			}
+
+			/// @brief Collects the event's handler-backlog metrics.
+			/// @return EventDispatchMetrics The metrics.
+			EventDispatchMetrics getDispatchMetrics() {
+				EventDispatchMetrics returnData{};
+				returnData.totalDispatchedCount = totalDispatchedCount.load();
+				returnData.peakPendingCount = peakPendingCount.load();
+				returnData.pendingCount = pendingCount.load();
+				std::unique_lock lock{ dispatchMutex };
+				returnData.activeQueueCount = serialQueues.size();
+				return returnData;
+			}
+
 			/// @brief Invoke the event with provided arguments.
 			/// @param args The arguments to pass to the event delegates.
 			void operator()(const ArgTypes... args) {
-				std::unique_lock lock{ accessMutex };
-				for (auto& [key, value]: functions) {
-					try {
-						value.function(args...).get();
-					} catch (const DCAException& error) {
-						MessagePrinter::printError<PrintMessageType::General>(error.what());
-					}
+				EventDispatchMode dispatchModeNew{ dispatchMode.load() };
+				if (dispatchModeNew != EventDispatchMode::Synchronous) {
+					return dispatch(dispatchModeNew, args...);
+				}
+				std::shared_ptr<const HandlerArray> functionsNew{ loadHandlers() };
+				for (auto& value: *functionsNew) {
+					runHandler(value.function, args...);
 				}
 				return;
 			}
 
 		  protected:
+			std::shared_ptr<const HandlerArray> functions{ std::make_shared<const HandlerArray>() };
+			UnorderedMap<uint64_t, std::deque<std::function<void()>>> serialQueues{};
+			std::atomic<EventDispatchMode> dispatchMode{};
+			std::atomic_uint64_t totalDispatchedCount{};
+			std::atomic_uint64_t peakPendingCount{};
+			std::atomic_uint64_t pendingCount{};
+			uint64_t eventId{ EventDelegateToken::getNextId() };
+			std::mutex dispatchMutex{};
+			std::mutex snapshotMutex{};
 			std::mutex accessMutex{};
-			std::string eventId{};
+
+			/// @brief Collects the current handler array - held only for the copy of the pointer.
+			std::shared_ptr<const HandlerArray> loadHandlers() {
+				std::unique_lock lock{ snapshotMutex };
+				return functions;
+			}
+
+			/// @brief Publishes a new handler array.
+			void storeHandlers(std::shared_ptr<const HandlerArray> functionsNew) {
+				std::unique_lock lock{ snapshotMutex };
+				functions.swap(functionsNew);
+			}
+
+			/// @brief Queues the handlers onto the coroutine thread pool, without waiting for them.
+			void dispatch(EventDispatchMode dispatchModeNew, const ArgTypes&... args) {
+				std::shared_ptr<const HandlerArray> handlers{ loadHandlers() };
+				if (handlers->size() == 0) {
+					return;
+				}
+				if (dispatchModeNew == EventDispatchMode::Unordered) {
+					for (auto& value: *handlers) {
+						onDispatchQueued();
+						submitToThreadPool([=, this, handler = value.function]() {
+							runHandler(handler, args...);
+							pendingCount.fetch_sub(1);
+						});
+					}
+					return;
+				}
+				uint64_t orderingKey{};
+				((orderingKey = orderingKey != 0 ? orderingKey : getEventOrderingKey(dispatchModeNew, args)), ...);
+				onDispatchQueued();
+				std::unique_lock dispatchLock{ dispatchMutex };
+				auto& serialQueue = serialQueues[orderingKey];
+				serialQueue.emplace_back([=, this, handlers = std::move(handlers)]() {
+					for (auto& value: *handlers) {
+						runHandler(value.function, args...);
+					}
+				});
+				if (serialQueue.size() == 1) {
+					dispatchLock.unlock();
+					submitToThreadPool([=, this]() {
+						drainSerialQueue(orderingKey);
+					});
+				}
+			}
+
+			/// @brief Retires the dispatch at the front of a serial queue when it goes out of scope - even if the dispatch threw - so that a
+			/// queue is never left holding work without a drain to run it.
+			class SerialDispatchScope {
+			  public:
+				inline SerialDispatchScope(Event& eventNew, uint64_t orderingKeyNew, bool& isThereMoreNew)
+					: event{ eventNew }, isThereMore{ isThereMoreNew }, orderingKey{ orderingKeyNew } {};
+
+				inline ~SerialDispatchScope() {
+					event.pendingCount.fetch_sub(1);
+					std::unique_lock lock{ event.dispatchMutex };
+					event.serialQueues[orderingKey].pop_front();
+					isThereMore = event.serialQueues[orderingKey].size() > 0;
+					if (!isThereMore) {
+						event.serialQueues.erase(orderingKey);
+					} else if (std::uncaught_exceptions() > 0) {
+						lock.unlock();
+						submitToThreadPool([&eventNew = event, orderingKeyNew = orderingKey]() {
+							eventNew.drainSerialQueue(orderingKeyNew);
+						});
+					}
+				}
+
+			  protected:
+				Event& event;
+				bool& isThereMore;
+				uint64_t orderingKey{};
+			};
+
+			/// @brief Runs the queued dispatches for one key, in order - the running dispatch stays at the front of the queue until it is done,
+			/// so that only one drain per key is ever launched.
+			void drainSerialQueue(uint64_t orderingKey) {
+				bool isThereMore{ true };
+				while (isThereMore) {
+					std::unique_lock lock{ dispatchMutex };
+					std::function<void()> currentDispatch{ std::move(serialQueues[orderingKey].front()) };
+					lock.unlock();
+					SerialDispatchScope dispatchScope{ *this, orderingKey, isThereMore };
+					currentDispatch();
+				}
+			}
+
+			void runHandler(const std::function<ReturnType(ArgTypes...)>& handler, const ArgTypes&... args) {
+				try {
+					handler(args...).get();
+				} catch (const std::exception& error) {
+					MessagePrinter::printError<PrintMessageType::General>(error.what());
+				} catch (...) {
+					MessagePrinter::printError<PrintMessageType::General>("EventDelegate::runHandler() Error: A handler threw an unknown exception.");
+				}
+			}
+
+			void onDispatchQueued() {
+				totalDispatchedCount.fetch_add(1);
+				uint64_t pendingCountNew{ pendingCount.fetch_add(1) + 1 };
+				uint64_t peakPendingCountNew{ peakPendingCount.load() };
+				while (pendingCountNew > peakPendingCountNew && !peakPendingCount.compare_exchange_weak(peakPendingCountNew, pendingCountNew)) {
+				}
+			}
 		};
 
 		/// @brief Event-delegate, for representing an event-function to be executed conditionally.
@@ -327,9 +538,9 @@ namespace DiscordCoreAPI {
 					other.functions = UnorderedMap<EventDelegateToken, TriggerEventDelegate<ReturnType, ArgTypes...>>{};
 
 					// Move the eventId from 'other' to the current instance.
-					eventId = std::move(other.eventId);
-					// Clear 'other' eventId.
-					other.eventId = std::string{};
+					eventId = other.eventId;
+					// Give 'other' a fresh eventId.
+					other.eventId = EventDelegateToken::getNextId();
 				}
 				return *this;
 			}
@@ -344,18 +555,15 @@ namespace DiscordCoreAPI {
 			}
 
 			/// @brief Default constructor for TriggerEvent class.
-			TriggerEvent() {
-				std::unique_lock lock{ accessMutex };
-				eventId = std::to_string(std::chrono::duration_cast<Microseconds>(HRClock::now().time_since_epoch()).count());
-			}
+			TriggerEvent() = default;
 
 			/// @brief Add an event delegate to the event.
 			/// @param eventDelegate The event delegate to add.
-			/// @return EventDelegateToken The token representing the added event delegate.
+			/// @return EventDelegateToken The token representing the added event event.
 			EventDelegateToken add(TriggerEventDelegate<ReturnType, ArgTypes...> eventDelegate) {
 				std::unique_lock lock{ accessMutex };
 				EventDelegateToken eventToken{};
-				eventToken.handlerId = std::to_string(std::chrono::duration_cast<Microseconds>(HRClock::now().time_since_epoch()).count());
+				eventToken.handlerId = EventDelegateToken::getNextId();
 				eventToken.eventId = eventId;
 				functions[eventToken] = std::move(eventDelegate);
 				return eventToken;
@@ -386,8 +594,8 @@ namespace DiscordCoreAPI {
 			}
 
 		  protected:
+			uint64_t eventId{ EventDelegateToken::getNextId() };
 			std::mutex accessMutex{};
-			std::string eventId{};
 		};
 
 		/**@}*/
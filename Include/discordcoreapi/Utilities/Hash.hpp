@@ -82,6 +82,14 @@ namespace DiscordCoreAPI {
 		template<GuildMemberT ValueType> TwoIdKey(const ValueType& other);
 		template<VoiceStateT ValueType> TwoIdKey(const ValueType& other);
 
+		inline TwoIdKey(Snowflake idOneNew, Snowflake idTwoNew) : idOne{ idOneNew }, idTwo{ idTwoNew } {};
+
+		inline TwoIdKey() = default;
+
+		inline bool operator==(const TwoIdKey& other) const {
+			return idOne == other.idOne && idTwo == other.idTwo;
+		}
+
 		Snowflake idOne{};
 		Snowflake idTwo{};
 	};
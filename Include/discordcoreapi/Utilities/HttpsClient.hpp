@@ -31,7 +31,16 @@
 #pragma once
 
 #include <discordcoreapi/Utilities/TCPConnection.hpp>
+#include <discordcoreapi/Utilities/ThreadWrapper.hpp>
 #include <discordcoreapi/JsonSpecializations.hpp>
+#include <condition_variable>
+#include <typeindex>
+#include <coroutine>
+#include <memory>
+#include <deque>
+#include <tuple>
+
+struct z_stream_s;
 
 namespace DiscordCoreAPI {
 
@@ -51,6 +60,7 @@ namespace DiscordCoreAPI {
 				Forbidden = 403,///< The Authorization token you passed did not have permission to the resource.
 				Not_Found = 404,///< The resource at the location specified doesn't exist.
 				Method_Not_Allowed = 405,///< The HTTPS method used is not valid for the location specified.
+				Payload_Too_Large = 413,///< The response body decompressed to more than the library accepts.
 				Too_Many_Requests = 429,///< You are being rate limited, see Rate Limits.
 				Gatewat_Unavailable = 502,///< There was not a gateway available to process your request. Wait a bit and retry.
 			};
@@ -65,6 +75,7 @@ namespace DiscordCoreAPI {
 				{ static_cast<HttpsResponseCodes>(403), "The Authorization token you passed did not have permission to the resource" },
 				{ static_cast<HttpsResponseCodes>(404), "The resource at the location specified doesn't exist" },
 				{ static_cast<HttpsResponseCodes>(405), "The HTTPS method used is not valid for the location specified" },
+				{ static_cast<HttpsResponseCodes>(413), "The response body decompressed to more than the library accepts" },
 				{ static_cast<HttpsResponseCodes>(429), "You are being rate limited, see Rate Limits" },
 				{ static_cast<HttpsResponseCodes>(502), "There was not a gateway available to process your request.Wait a bit and retry" },
 				{ static_cast<HttpsResponseCodes>(500), "The server had an error processing your request(these are rare)" } };
@@ -92,9 +103,25 @@ namespace DiscordCoreAPI {
 
 		class HttpsConnectionManager;
 		struct RateLimitData;
+		class HttpsClient;
 
 		enum class HttpsState { Collecting_Headers = 0, Collecting_Contents = 1, Collecting_Chunked_Contents = 2, Complete = 3 };
 
+		/// @brief Content encodings that the response pipeline knows how to decode.
+		enum class HttpsContentEncoding {
+			Identity = 0,///< The body was sent as-is.
+			Gzip = 1,///< The body is gzip-compressed.
+			Deflate = 2///< The body is deflate-compressed, either zlib-wrapped or raw.
+		};
+
+		/// @brief Where the chunked-transfer decoder currently is within the stream.
+		enum class HttpsChunkState {
+			Size = 0,///< Waiting for a chunk-size line.
+			Data = 1,///< Copying chunk data into the response body.
+			Data_End = 2,///< Waiting for the CRLF that follows a chunk's data.
+			Trailer = 3///< Skipping trailer lines until the final empty line.
+		};
+
 		class HttpsError : public DCAException {
 		  public:
 			int32_t errorCode{};
@@ -107,30 +134,87 @@ namespace DiscordCoreAPI {
 			friend class HttpsConnection;
 			friend class HttpsClient;
 
-			UnorderedMap<std::string, std::string> responseHeaders{};
+			UnorderedMap<std::string, std::string> responseHeaders{};///< Only the headers named in the workload's headersToCollect.
 			HttpsResponseCode responseCode{ static_cast<uint32_t>(-1) };
 			HttpsState currentState{ HttpsState::Collecting_Headers };
 			std::string responseData{};
 			uint64_t contentLength{};
 
 		  protected:
+			int64_t rateLimitResetAfterMs{ -1 };///< The decoded x-ratelimit-reset-after value, or -1 if absent.
+			int64_t rateLimitRemaining{ -1 };///< The decoded x-ratelimit-remaining value, or -1 if absent.
+			std::string rateLimitBucket{};///< The x-ratelimit-bucket value, if present.
+			int64_t retryAfterMs{ -1 };///< The decoded retry-after value of a 429, or -1 if absent.
+			bool isItGlobalRateLimit{};///< Whether a 429 was for the global rate limit, rather than the bucket's.
+			HttpsContentEncoding contentEncoding{ HttpsContentEncoding::Identity };///< The body's content-encoding.
+			HttpsChunkState chunkState{ HttpsChunkState::Size };///< The chunked-transfer decoder's state.
+			uint64_t chunkBytesRemaining{};///< Bytes still to be copied from the current chunk.
 			bool isItChunked{};
 		};
 
 		class HttpsConnection;
 
+		/// @brief Inflates gzip and deflate response bodies, reusing its zlib stream and output buffer between responses.
+		class HttpsInflater {
+		  public:
+			static constexpr uint64_t maxOutputSize{ 64ull * 1024ull * 1024ull };///< The most that one body may inflate to.
+
+			bool didItExceedLimit{};///< Whether the last failed decompress() stopped at maxOutputSize.
+
+			HttpsInflater() = default;
+
+			HttpsInflater& operator=(const HttpsInflater&) = delete;
+			HttpsInflater(const HttpsInflater&) = delete;
+
+			/// @brief Replaces a compressed body with its decompressed contents.
+			/// @param data The body to decompress in place.
+			/// @param encoding The encoding named by the response's content-encoding header.
+			/// @return Whether the body was decoded successfully - false if it was corrupt, or inflated past maxOutputSize.
+			bool decompress(std::string& data, HttpsContentEncoding encoding);
+
+			~HttpsInflater();
+
+		  protected:
+			std::string outputBuffer{};
+			z_stream_s* stream{};
+
+			bool decompressInternal(std::string_view data, int32_t windowBits);
+		};
+
 		class HttpsTCPConnection : public TCPConnection<HttpsTCPConnection>, public SSLDataInterface<HttpsTCPConnection> {
 		  public:
 			HttpsTCPConnection() = default;
 
 			HttpsTCPConnection(const std::string& baseUrlNew, const uint16_t portNew, HttpsConnection* ptrNew);
 
+			/// @brief Constructor for a connection that is not yet connected - for setting up with beginSetup(), on the HttpsReactor.
+			/// @param ptrNew The HttpsConnection that the responses are collected into.
+			HttpsTCPConnection(HttpsConnection* ptrNew);
+
 			void handleBuffer();
 
 		  protected:
 			HttpsConnection* ptr{};
 		};
 
+		/// @brief The parts of a request that only change along with the workload's type - prebuilt once, and reused while they still match.
+		struct HttpsRequestTemplate {
+			HttpsWorkloadClass workloadClass{};///< The method that the template was built for.
+			PayloadType payloadType{};///< The payload type that the template was built for.
+			std::string authorization{};///< The Authorization header line that the template was built with, if any.
+			std::string requestLineStart{};///< The method and base url, which the relative path is written after.
+			std::string staticHeaders{};///< Every header line that does not depend on the request's contents.
+			std::string baseUrl{};///< The base url that the template was built for.
+			bool acceptCompressed{};///< Whether the template asks for a compressed body.
+			bool isItBuilt{};
+
+			/// @brief Checks whether the template can serve a given workload.
+			/// @param workload The workload to check.
+			/// @param authorizationNew The Authorization header line that the workload is to be sent with.
+			/// @return Whether the template was built for the same method, base url, payload type and headers.
+			bool matches(const HttpsWorkloadData& workload, std::string_view authorizationNew) const;
+		};
+
 		class HttpsRnRBuilder {
 		  public:
 			friend class HttpsClient;
@@ -139,7 +223,11 @@ namespace DiscordCoreAPI {
 
 			HttpsResponseData finalizeReturnValues(RateLimitData& rateLimitData);
 
-			std::string buildRequest(const HttpsWorkloadData& workload);
+			/// @brief Serialises a request into this builder's output buffer - reused between requests, and reserved once per request.
+			/// @param workload The workload to serialise.
+			/// @param authorization The complete Authorization header line, or empty for requests that are sent without one.
+			/// @return A view of the serialised request - valid until the next call.
+			std::string_view buildRequest(const HttpsWorkloadData& workload, std::string_view authorization);
 
 			void updateRateLimitData(RateLimitData& rateLimitData);
 
@@ -148,11 +236,107 @@ namespace DiscordCoreAPI {
 			virtual ~HttpsRnRBuilder() = default;
 
 		  protected:
+			static constexpr uint64_t maxChunkSizeDigits{ 16 };///< The most hex digits that a chunk size may have - enough for any uint64_t.
+			static constexpr uint64_t maxFramingSize{ 64 };///< Room for the request line's end, the Content-Length line and the blank line.
+
+			HttpsRequestTemplate requestTemplate{};
+			std::string requestBuffer{};
+
+			void buildRequestTemplate(const HttpsWorkloadData& workload, std::string_view authorization);
+
 			bool parseContents();
 
 			bool parseChunk();
 		};
 
+		/// @brief A FIFO queue for the right to use a connection or a rate-limit bucket, serving its lanes in priority order. Waiters are
+		/// parked as continuations, which are handed to the thread pool once it is their turn - so no thread is held while waiting.
+		class HttpsLaneQueue {
+		  public:
+			HttpsLaneQueue() = default;
+
+			/// @brief Takes the queue if it is free and nobody in this or a higher lane is waiting, or parks a continuation until it is handed over.
+			/// @param lane The lane to queue in.
+			/// @param continuation Run on the thread pool once the queue has been handed to this waiter - not run if it was taken immediately.
+			/// @return Whether the queue was taken immediately.
+			bool tryAcquireOrQueue(RestLane lane, std::function<void()> continuation);
+
+			/// @brief Blocks the calling thread until the queue has been taken - for the synchronous request path.
+			/// @param lane The lane to queue in.
+			void acquire(RestLane lane);
+
+			/// @brief Hands the queue to the next waiter, or frees it if nobody is waiting.
+			void release();
+
+		  protected:
+			std::array<std::deque<std::function<void()>>, static_cast<uint64_t>(RestLane::LAST)> lanes{};
+			std::mutex accessMutex{};
+			bool isItHeld{};
+		};
+
+		/// @brief Coordinates every REST request against the global rate limit - one 429 closes the gate for all of them, and requests
+		/// pass it in lane order, paced to the global limit. Interaction endpoints, which Discord exempts from the global limit, skip it.
+		/// Waiting requests are parked in per-lane queues, and a single TimerWheel timer lets them through as the gate reopens.
+		class HttpsRestScheduler {
+		  public:
+			static constexpr int64_t globalRequestsPerSecond{ 50 };
+
+			HttpsRestScheduler() = default;
+
+			/// @brief Passes the gate if it is open, the next pacing slot has come, and nobody in this or a higher lane is waiting - or parks
+			/// a continuation, to be run on the thread pool once it is this request's turn.
+			/// @param lane The lane of the request.
+			/// @param continuation Run once the request has passed the gate - not run if it passed immediately.
+			/// @return Whether the request passed immediately.
+			bool tryPassGlobalGate(RestLane lane, std::function<void()> continuation);
+
+			/// @brief Blocks the calling thread until the request has passed the gate - for the synchronous request path.
+			/// @param lane The lane of the waiting request.
+			void waitOnGlobalRateLimit(RestLane lane);
+
+			/// @brief Closes the global gate after a global 429.
+			/// @param retryAfter How long Discord asked for the gate to stay closed.
+			void closeGlobalGate(Milliseconds retryAfter);
+
+			/// @brief Records how long a request spent queued.
+			/// @param lane The lane of the request.
+			/// @param queueLatency The time between the request being queued and its being sent.
+			void recordQueueLatency(RestLane lane, Milliseconds queueLatency);
+
+			/// @brief Collects the queue latency statistics of a lane.
+			/// @param lane The lane to collect the statistics of.
+			/// @return The lane's statistics.
+			RestLaneStats getLaneStats(RestLane lane);
+
+			/// @brief Selects the lane for a type of workload.
+			/// @param workloadType The type of workload.
+			/// @return The workload's lane.
+			static RestLane getLane(HttpsWorkloadType workloadType);
+
+			/// @brief Checks whether a type of workload is sent to an interaction endpoint, which the global rate limit does not apply to.
+			/// @param workloadType The type of workload.
+			/// @return Whether the workload skips the global gate.
+			static bool isExemptFromGlobalLimit(HttpsWorkloadType workloadType);
+
+			~HttpsRestScheduler();
+
+		  protected:
+			std::array<std::deque<std::function<void()>>, static_cast<uint64_t>(RestLane::LAST)> waiters{};
+			std::array<RestLaneStats, static_cast<uint64_t>(RestLane::LAST)> laneStats{};
+			Milliseconds globalBlockedUntil{};
+			Milliseconds nextSlotTime{};
+			std::mutex statsMutex{};
+			std::mutex accessMutex{};
+			uint64_t wakeUpTimerId{};
+
+			/// @brief Arms the wake-up timer for when the gate next opens, if it is not already armed. Called with accessMutex held.
+			/// @param currentTime The current time.
+			void armWakeUp(Milliseconds currentTime);
+
+			/// @brief Lets the waiting requests through in lane order, as far as the gate and the pacing allow.
+			void onWakeUp();
+		};
+
 		struct RateLimitData {
 			friend class RateLimitStackHolder;
 			friend class HttpsConnectionManager;
@@ -161,13 +345,13 @@ namespace DiscordCoreAPI {
 
 		  protected:
 			std::atomic<Milliseconds> sampledTimeInMs{ Milliseconds{} };
-			std::counting_semaphore<1> theSemaphore{ 1 };
 			std::atomic<Seconds> sRemain{ Seconds{} };
 			std::atomic_bool areWeASpecialBucket{};
 			std::atomic_bool didWeHitRateLimit{};
 			std::atomic_int64_t getsRemaining{};
 			std::atomic_bool haveWeGoneYet{};
 			std::atomic_bool doWeWait{};
+			HttpsLaneQueue queue{};
 			std::string tempBucket{};
 			std::string bucket{};
 		};
@@ -176,13 +360,14 @@ namespace DiscordCoreAPI {
 		  public:
 			friend class HttpsTCPConnection;
 
-			std::counting_semaphore<1> theSemaphore{ 1 };
 			const int32_t maxReconnectTries{ 3 };
+			HttpsLaneQueue queue{};///< Serialises the requests that share this connection.
 			String inputBufferReal{};
 			HttpsTCPConnection tcpConnection{};
 			int32_t currentReconnectTries{};
 			HttpsWorkloadData workload{};
 			std::string currentBaseUrl{};
+			HttpsInflater inflater{};
 			HttpsResponseData data{};
 
 			HttpsConnection() = default;
@@ -231,12 +416,160 @@ namespace DiscordCoreAPI {
 		  public:
 			RateLimitStackHolder(HttpsConnectionManager& connectionManager, HttpsWorkloadType workload);
 
+			/// @brief Blocks until the bucket's queue has been taken - for the synchronous request path.
+			void acquire();
+
+			/// @brief Takes the bucket's queue, or parks a continuation until it has been handed over.
+			/// @param continuation Run on the thread pool once the queue has been taken - not run if it was taken immediately.
+			/// @return Whether the queue was taken immediately.
+			bool tryAcquireOrQueue(std::function<void()> continuation);
+
 			RateLimitData& getRateLimitData();
 
+			RestLane getLane() const;
+
+			bool isExemptFromGlobalLimit() const;
+
+			/// @brief Collects the time since the request was queued - once, for the first send, and zero afterwards.
+			/// @param queueLatency Set to the time spent queued.
+			/// @return Whether this was the first call.
+			bool takeQueueLatency(Milliseconds& queueLatency);
+
 			~RateLimitStackHolder();
 
 		  protected:
 			RateLimitData* rateLimitData{};
+			bool isItExemptFromGlobalLimit{};
+			std::atomic_bool isItHeld{};
+			Milliseconds enqueuedAt{};
+			bool wasItDequeued{};
+			RestLane lane{};
+		};
+
+		/// @brief Waits on the sockets of every in-flight REST request from a single thread, handing each request's continuation to the thread
+		/// pool once its response has arrived, failed, or timed out - or, for a connection that is still being set up, once its setup has
+		/// completed or failed.
+		class HttpsReactor {
+		  public:
+			/// @brief Constructor for the HttpsReactor - launches its thread.
+			HttpsReactor();
+
+			HttpsReactor& operator=(const HttpsReactor&) = delete;
+			HttpsReactor(const HttpsReactor&) = delete;
+
+			/// @brief Hands over a connection whose request has been written, or whose setup has been begun.
+			/// @param connection The connection to wait on - it must not be touched again until the continuation has run.
+			/// @param continuation Run on the thread pool once the response is done with.
+			void submit(HttpsConnection* connection, std::function<void()> continuation);
+
+			~HttpsReactor();
+
+		  protected:
+			struct PendingRequest {
+				std::function<void()> continuation{};
+				HttpsConnection* connection{};
+				Milliseconds deadline{};
+				bool isItSetup{};///< Whether this is a connection's setup, which times out on its own, rather than a request.
+			};
+
+			UnorderedMap<uint64_t, PendingRequest> pendingRequests{};
+			Jsonifier::Vector<PendingRequest> newRequests{};
+			std::condition_variable wakeCondition{};
+			std::mutex accessMutex{};
+			uint64_t currentId{};
+			ThreadWrapper thread{};
+
+			void run(StopToken stopToken);
+		};
+
+		/// @brief How a GET request was matched against the requests already in flight, or already cached.
+		enum class SharedRequestRole {
+			Leader = 0,///< No identical request was in flight - this one is sent, and its result shared.
+			Follower = 1,///< An identical request was in flight - this one waits on its result.
+			Cached = 2///< A live cached result was found - nothing is sent.
+		};
+
+		/// @brief The result of a GET request, shared by every identical request that arrived while it was in flight.
+		struct SharedRequest {
+			Jsonifier::Vector<std::coroutine_handle<>> waiters{};///< The followers to resume once the result is in.
+			std::shared_ptr<const void> parsedValue{};///< The leader's parsed object, if it had exactly one.
+			std::type_index parsedType{ typeid(void) };///< The type of parsedValue.
+			std::exception_ptr exception{};///< The error that the leader's request ended in, if any.
+			HttpsWorkloadType workloadType{};
+			HttpsResponseData response{};
+			std::string key{};
+		};
+
+		/// @brief One REST request's trip through the client - its connection, its bucket's queue, the bucket's reset, the global gate, the
+		/// response, and any 429 retries. Each wait is parked on a queue, the TimerWheel or the HttpsReactor rather than on a thread, and the
+		/// awaiting CoRoutine is resumed on the thread pool once there is a final response.
+		class HttpsRequestOperation {
+		  public:
+			HttpsRequestOperation(HttpsClient* clientNew, HttpsWorkloadData&& workloadNew);
+
+			HttpsRequestOperation& operator=(const HttpsRequestOperation&) = delete;
+			HttpsRequestOperation(const HttpsRequestOperation&) = delete;
+
+			/// @brief Starts the request - the operation must not move until the CoRoutine has been resumed.
+			/// @param coroHandleNew The CoRoutine to resume once the request has finished.
+			void start(std::coroutine_handle<> coroHandleNew);
+
+			/// @brief Collects the final response, rethrowing whatever the request failed with.
+			/// @return The response.
+			HttpsResponseData takeResult();
+
+			/// @brief Collects the connection that the request was sent on - valid once takeResult() has returned.
+			HttpsConnection& getConnection();
+
+			~HttpsRequestOperation();
+
+		  protected:
+			using Step = void (HttpsRequestOperation::*)();
+
+			UniquePtr<RateLimitStackHolder> rateLimitHolder{};
+			std::coroutine_handle<> coroHandle{};
+			HttpsConnection* connection{};
+			std::exception_ptr exception{};
+			HttpsResponseData returnData{};
+			HttpsWorkloadData workload{};
+			bool isConnectionHeld{};
+			HttpsClient* client{};
+			bool isItConnecting{};
+			int32_t retryCount{};
+			RestLane lane{};
+
+			/// @brief Runs a step, finishing the operation with its exception if it throws.
+			void advance(Step step);
+
+			/// @brief Returns a continuation that runs a step - for handing to a queue, the TimerWheel or the HttpsReactor.
+			std::function<void()> continueWith(Step step);
+
+			void acquireConnection();
+
+			void acquireBucket();
+
+			void waitOnBucketReset();
+
+			void waitOnGlobalGate();
+
+			void sendRequest();
+
+			/// @brief Writes the request once the connection is up - handing the connection's setup to the HttpsReactor first, if it needs one.
+			void connectAndWrite();
+
+			void collectResponse();
+
+			void finalizeResponse();
+
+			void finish();
+		};
+
+		template<typename... Args> struct SingleArgType {
+			using type = void;
+		};
+
+		template<typename ArgType> struct SingleArgType<ArgType> {
+			using type = std::remove_cvref_t<ArgType>;
 		};
 
 		template<typename ObjectType>
@@ -275,10 +608,19 @@ namespace DiscordCoreAPI {
 			}
 
 		  protected:
+			std::string authorizationHeader{};
 			std::string botToken{};
 
 			HttpsResponseData httpsRequestInternal(HttpsConnection& connection, RateLimitData& rateLimitData);
 
+			bool sendRequest(HttpsConnection& connection);
+
+			/// @brief Writes the request on a connection that is already up.
+			/// @return Whether the write succeeded.
+			bool writeRequest(HttpsConnection& connection);
+
+			HttpsResponseData resumeResponse(HttpsConnection& connection, RateLimitData& rateLimitData);
+
 			HttpsResponseData recoverFromError(HttpsConnection& connection, RateLimitData& rateLimitData);
 
 			HttpsResponseData getResponse(HttpsConnection& connection, RateLimitData& rateLimitData);
@@ -286,26 +628,160 @@ namespace DiscordCoreAPI {
 
 		class DiscordCoreAPI_Dll HttpsClient : public HttpsClientCore {
 		  public:
+			friend class HttpsRequestOperation;
+
+			/// @brief An awaitable that sends a request and suspends the awaiting CoRoutine until the HttpsReactor has its response.
+			/// @tparam Args The types of the objects to parse the response into.
+			template<typename... Args> class RequestAwaitable {
+			  public:
+				using SharedValueType = typename SingleArgType<Args...>::type;
+
+				/// @brief Whether followers can copy the leader's parsed object, rather than parsing the shared response themselves.
+				static constexpr bool canShareParsedValue =
+					std::is_copy_constructible_v<SharedValueType> && std::is_copy_assignable_v<SharedValueType>;
+
+				inline RequestAwaitable(HttpsClient* clientNew, HttpsWorkloadData&& workloadNew, Args&... argsNew)
+					: workload{ std::move(workloadNew) }, args{ argsNew... }, client{ clientNew } {};
+
+				inline bool await_ready() const {
+					return false;
+				}
+
+				inline bool await_suspend(std::coroutine_handle<> coroHandle) {
+					role = client->joinSharedRequest(workload, coroHandle, sharedRequest);
+					if (role == SharedRequestRole::Follower) {
+						return true;
+					} else if (role == SharedRequestRole::Cached) {
+						return false;
+					}
+					operation = makeUnique<HttpsRequestOperation>(client, std::move(workload));
+					operation->start(coroHandle);
+					return true;
+				}
+
+				inline void await_resume() {
+					if (role != SharedRequestRole::Leader) {
+						return resumeFromSharedRequest();
+					}
+					try {
+						resumeAsLeader();
+					} catch (...) {
+						if (sharedRequest) {
+							sharedRequest->exception = std::current_exception();
+							client->completeSharedRequest(sharedRequest);
+						}
+						throw;
+					}
+					if (sharedRequest) {
+						client->completeSharedRequest(sharedRequest);
+					}
+				}
+
+			  protected:
+				UniquePtr<HttpsRequestOperation> operation{};
+				std::shared_ptr<SharedRequest> sharedRequest{};
+				SharedRequestRole role{};
+				HttpsWorkloadData workload{};
+				std::tuple<Args&...> args;
+				HttpsClient* client{};
+
+				/// @brief Parses the response - publishing it to the shared request, if there is one.
+				inline void resumeAsLeader() {
+					HttpsResponseData returnData{ operation->takeResult() };
+					std::apply(
+						[&](auto&... argsNew) {
+							client->processResult(operation->getConnection().workload, returnData, argsNew...);
+						},
+						args);
+					if (sharedRequest) {
+						shareParsedValue();
+						sharedRequest->response = std::move(returnData);
+					}
+				}
+
+				inline void shareParsedValue() {
+					if constexpr (canShareParsedValue) {
+						sharedRequest->parsedValue = std::make_shared<const SharedValueType>(std::get<0>(args));
+						sharedRequest->parsedType = typeid(SharedValueType);
+					}
+				}
+
+				inline void resumeFromSharedRequest() {
+					if (sharedRequest->exception) {
+						std::rethrow_exception(sharedRequest->exception);
+					}
+					if constexpr (canShareParsedValue) {
+						if (sharedRequest->parsedValue && sharedRequest->parsedType == typeid(SharedValueType)) {
+							std::get<0>(args) = *static_cast<const SharedValueType*>(sharedRequest->parsedValue.get());
+							return;
+						}
+					}
+					HttpsResponseData returnData{ sharedRequest->response };
+					std::apply(
+						[&](auto&... argsNew) {
+							client->processResult(workload, returnData, argsNew...);
+						},
+						args);
+				}
+			};
+
 			HttpsClient(const std::string& botTokenNew);
 
 			template<typename... Args> void submitWorkloadAndGetResult(HttpsWorkloadData&& workload, Args&... args) {
 				HttpsConnectionStackHolder stackHolder{ connectionManager, std::move(workload) };
 				auto& connection = stackHolder.getConnection();
 				HttpsResponseData returnDataNew = httpsRequest(connection);
+				processResult(connection.workload, returnDataNew, args...);
+			}
+
+			/// @brief Collects the queue latency statistics of one of the REST priority lanes.
+			/// @param lane The lane to collect the statistics of.
+			/// @return The lane's statistics.
+			RestLaneStats getLaneStats(RestLane lane);
+
+			/// @brief Lets successful GET responses of a given workload type be reused for a while, instead of being re-requested.
+			/// @param workloadType The type of workload to cache the responses of.
+			/// @param ttl How long each response may be reused for - zero disables the cache for this type.
+			void setResponseCacheTtl(HttpsWorkloadType workloadType, Milliseconds ttl);
+
+			/// @brief Submits a workload without blocking the calling thread while its response is in flight.
+			/// @param workload The workload to submit.
+			/// @param args The objects to parse the response into.
+			/// @return An awaitable that resumes once the response has been collected and parsed.
+			template<typename... Args> RequestAwaitable<Args...> submitWorkloadAndGetResultAsync(HttpsWorkloadData&& workload, Args&... args) {
+				return RequestAwaitable<Args...>{ this, std::move(workload), args... };
+			}
+
+		  protected:
+			static constexpr int32_t maxRateLimitRetries{ 3 };
+
+			struct CachedResponse {
+				std::shared_ptr<SharedRequest> request{};
+				Milliseconds expiry{};
+			};
 
+			UnorderedMap<std::string, std::shared_ptr<SharedRequest>> inFlightRequests{};
+			UnorderedMap<HttpsWorkloadType, Milliseconds> responseCacheTtls{};
+			UnorderedMap<std::string, CachedResponse> responseCache{};
+			HttpsConnectionManager connectionManager{};
+			std::mutex sharedRequestMutex{};
+			HttpsRestScheduler scheduler{};
+			HttpsReactor reactor{};
+
+			template<typename... Args> void processResult(HttpsWorkloadData& workload, HttpsResponseData& returnDataNew, Args&... args) {
 				if (static_cast<uint32_t>(returnDataNew.responseCode) != 200 && static_cast<uint32_t>(returnDataNew.responseCode) != 204 &&
 					static_cast<uint32_t>(returnDataNew.responseCode) != 201) {
 					std::string errorMessage{};
-					if (connection.workload.callStack != "") {
-						errorMessage += connection.workload.callStack + " ";
+					if (workload.callStack != "") {
+						errorMessage += workload.callStack + " ";
 					}
-					errorMessage += "Https Error: " + returnDataNew.responseCode.operator std::string() +
-						"\nThe Request: Base Url: " + connection.workload.baseUrl + "\n";
-					if (!connection.workload.relativePath.empty()) {
-						errorMessage += "Relative Url: " + connection.workload.relativePath + "\n";
+					errorMessage +=
+						"Https Error: " + returnDataNew.responseCode.operator std::string() + "\nThe Request: Base Url: " + workload.baseUrl + "\n";
+					if (!workload.relativePath.empty()) {
+						errorMessage += "Relative Url: " + workload.relativePath + "\n";
 					}
-					if (!connection.workload.content.empty()) {
-						errorMessage += "Content: " + connection.workload.content + "\n";
+					if (!workload.content.empty()) {
+						errorMessage += "Content: " + workload.content + "\n";
 					}
 					if (!returnDataNew.responseData.empty()) {
 						errorMessage += "The Response: " + returnDataNew.responseData;
@@ -322,10 +798,27 @@ namespace DiscordCoreAPI {
 				}
 			}
 
-		  protected:
-			HttpsConnectionManager connectionManager{};
+			/// @brief Matches a GET request against the identical requests in flight and the response cache.
+			/// @param workload The request's workload.
+			/// @param coroHandle The awaiting CoRoutine, which is queued for resumption if the request becomes a follower.
+			/// @param sharedRequest Set to the shared result - left empty for requests that are never shared.
+			/// @return The role that the request takes.
+			SharedRequestRole joinSharedRequest(const HttpsWorkloadData& workload, std::coroutine_handle<> coroHandle,
+				std::shared_ptr<SharedRequest>& sharedRequest);
+
+			/// @brief Publishes a leader's result - caching it if its type has a ttl - and resumes its followers.
+			void completeSharedRequest(const std::shared_ptr<SharedRequest>& sharedRequest);
+
+			/// @brief Works out how long a request must wait for its bucket to reset, updating the bucket's state for the send.
+			/// @return The time left to wait - zero or less if the request can be sent now.
+			Milliseconds collectRateLimitDelay(HttpsConnection& connection, RateLimitData& rateLimitData);
+
+			void waitOnRateLimit(HttpsConnection& connection, RateLimitStackHolder& rateLimitHolder);
+
+			HttpsResponseData finalizeRequest(HttpsConnection& connection, RateLimitData& rateLimitData, HttpsResponseData&& returnData);
 
-			HttpsResponseData executeByRateLimitData(HttpsConnection& connection, RateLimitData& rateLimitData);
+			/// @brief Sends a request, retrying it after each 429 - up to maxRateLimitRetries times, after which the 429 is returned.
+			HttpsResponseData executeByRateLimitData(HttpsConnection& connection, RateLimitStackHolder& rateLimitHolder);
 
 			HttpsResponseData httpsRequest(HttpsConnection& connection);
 		};
@@ -0,0 +1,209 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// MPMCQueue.hpp - Header file for the "MPMCQueue" stuff.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file MPMCQueue.hpp
+
+#pragma once
+
+#include <discordcoreapi/Utilities/Base.hpp>
+#include <bit>
+
+namespace DiscordCoreAPI {
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief A bounded, lock-free, multi-producer/multi-consumer queue, for data-structures.
+	/// @details Each slot carries a sequence number that tells producers and consumers whether it is free or filled, so that neither side
+	/// ever takes a lock. Consumers that find the queue empty park on a semaphore, which is released once per sent object, and producers that
+	/// find it full park on an atomic counter that is bumped once per received object - so nothing polls.
+	/// @tparam ValueType The type of object that will be sent over the queue.
+	template<CopyableOrMovable ValueType> class MPMCQueue {
+	  public:
+		/// @brief Constructor for MPMCQueue.
+		/// @param capacityNew The maximum number of objects that the queue can hold - rounded up to a power of two.
+		inline MPMCQueue(uint64_t capacityNew) : slots(std::bit_ceil(std::max<uint64_t>(capacityNew, 2))) {
+			mask = slots.size() - 1;
+			for (uint64_t x = 0; x < slots.size(); ++x) {
+				slots[x].sequence.store(x, std::memory_order_relaxed);
+			}
+		}
+
+		inline MPMCQueue<std::decay_t<ValueType>>& operator=(const MPMCQueue<std::decay_t<ValueType>>&) = delete;
+		inline MPMCQueue(const MPMCQueue&) = delete;
+
+		inline ~MPMCQueue() = default;
+
+		/// @brief Sends an object, if there is room for it.
+		/// @param object The object to send.
+		/// @return True if the object was sent, false if the queue was full.
+		template<typename ValueTypeNew> inline bool trySend(ValueTypeNew&& object) {
+			uint64_t position{ enqueuePosition.load(std::memory_order_relaxed) };
+			Slot* slot{};
+			while (true) {
+				slot = &slots[position & mask];
+				int64_t difference{ static_cast<int64_t>(slot->sequence.load(std::memory_order_acquire)) - static_cast<int64_t>(position) };
+				if (difference == 0) {
+					if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+						break;
+					}
+				} else if (difference < 0) {
+					return false;
+				} else {
+					position = enqueuePosition.load(std::memory_order_relaxed);
+				}
+			}
+			slot->value = std::forward<ValueTypeNew>(object);
+			slot->sequence.store(position + 1, std::memory_order_release);
+			itemCount.release();
+			return true;
+		}
+
+		/// @brief Sends an object, parking the calling thread while the queue is full.
+		/// @param object The object to send.
+		template<typename ValueTypeNew> inline void send(ValueTypeNew&& object) {
+			while (true) {
+				uint64_t currentEpoch{ spaceEpoch.load(std::memory_order_acquire) };
+				if (trySend(std::forward<ValueTypeNew>(object))) {
+					return;
+				}
+				waitingSenders.fetch_add(1, std::memory_order_seq_cst);
+				if (spaceEpoch.load(std::memory_order_seq_cst) == currentEpoch) {
+					spaceEpoch.wait(currentEpoch, std::memory_order_acquire);
+				}
+				waitingSenders.fetch_sub(1, std::memory_order_relaxed);
+			}
+		}
+
+		/// @brief Receives an object, if one is available.
+		/// @param object The object to receive into.
+		/// @return True if an object was received, false if the queue was empty.
+		inline bool tryReceive(ValueType& object) {
+			if (!itemCount.try_acquire()) {
+				return false;
+			}
+			dequeue(object);
+			return true;
+		}
+
+		/// @brief Receives an object, parking the calling thread until one is available.
+		/// @param object The object to receive into.
+		inline void receive(ValueType& object) {
+			itemCount.acquire();
+			dequeue(object);
+		}
+
+		/// @brief Receives an object, parking the calling thread until one is available or the timeout elapses.
+		/// @param object The object to receive into.
+		/// @param timeOut The maximum time to wait for.
+		/// @return True if an object was received, false if the timeout elapsed.
+		template<typename RepType, typename PeriodType> inline bool receiveFor(ValueType& object, std::chrono::duration<RepType, PeriodType> timeOut) {
+			if (!itemCount.try_acquire_for(timeOut)) {
+				return false;
+			}
+			dequeue(object);
+			return true;
+		}
+
+		/// @brief Receives as many objects as are available, up to a limit, without blocking.
+		/// @param objects A container to append the received objects to.
+		/// @param maxCount The maximum number of objects to receive.
+		/// @return The number of objects that were received.
+		template<typename ContainerType> inline uint64_t tryReceiveMany(ContainerType& objects, uint64_t maxCount) {
+			uint64_t receivedCount{};
+			ValueType object{};
+			while (receivedCount < maxCount && tryReceive(object)) {
+				objects.emplace_back(std::move(object));
+				++receivedCount;
+			}
+			return receivedCount;
+		}
+
+		inline void clearContents() {
+			ValueType object{};
+			while (tryReceive(object)) {
+			}
+		}
+
+		/// @brief Collects the approximate number of objects in the queue.
+		/// @return The number of objects.
+		inline uint64_t size() const {
+			uint64_t enqueued{ enqueuePosition.load(std::memory_order_acquire) };
+			uint64_t dequeued{ dequeuePosition.load(std::memory_order_acquire) };
+			return enqueued > dequeued ? enqueued - dequeued : 0;
+		}
+
+		inline uint64_t capacity() const {
+			return slots.size();
+		}
+
+	  protected:
+		struct alignas(64) Slot {
+			std::atomic_uint64_t sequence{};
+			std::decay_t<ValueType> value{};
+		};
+
+		alignas(64) std::atomic_uint64_t enqueuePosition{};
+		alignas(64) std::atomic_uint64_t dequeuePosition{};
+		alignas(64) std::atomic_uint64_t spaceEpoch{};
+		std::atomic_uint64_t waitingSenders{};
+		std::counting_semaphore<> itemCount{ 0 };
+		std::vector<Slot> slots{};
+		uint64_t mask{};
+
+		/// @brief Takes the object at the head of the queue - only called once a unit of itemCount has been acquired, so one is owed to us.
+		inline void dequeue(ValueType& object) {
+			uint64_t position{ dequeuePosition.load(std::memory_order_relaxed) };
+			Slot* slot{};
+			while (true) {
+				slot = &slots[position & mask];
+				int64_t difference{ static_cast<int64_t>(slot->sequence.load(std::memory_order_acquire)) - static_cast<int64_t>(position + 1) };
+				if (difference == 0) {
+					if (dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+						break;
+					}
+				} else if (difference < 0) {
+					std::this_thread::yield();
+					position = dequeuePosition.load(std::memory_order_relaxed);
+				} else {
+					position = dequeuePosition.load(std::memory_order_relaxed);
+				}
+			}
+			object = std::move(slot->value);
+			slot->sequence.store(position + mask + 1, std::memory_order_release);
+			spaceEpoch.fetch_add(1, std::memory_order_seq_cst);
+			if (waitingSenders.load(std::memory_order_seq_cst) > 0) {
+				spaceEpoch.notify_all();
+			}
+		}
+	};
+
+	/**@}*/
+}
@@ -32,6 +32,9 @@
 
 #include <discordcoreapi/Utilities/RingBuffer.hpp>
 #include <discordcoreapi/Utilities/EventEntities.hpp>
+#include <discordcoreapi/Utilities/ThreadWrapper.hpp>
+#include <condition_variable>
+#include <deque>
 
 #ifndef OPENSSL_NO_DEPRECATED
 	#define OPENSSL_NO_DEPRECATED
@@ -99,6 +102,14 @@ namespace DiscordCoreAPI {
 			SOCKET_Error = 7
 		};
 
+		/// @brief Where a connection's setup is - see TCPConnection::advanceSetup().
+		enum class SetupState {
+			Connecting = 0,///< Waiting on the happy-eyeballs connect attempts.
+			Handshaking = 1,///< Connected, and waiting on the TLS handshake.
+			Complete = 2,///< Connected, with the handshake done.
+			Failed = 3///< No address accepted, or the handshake failed, in time.
+		};
+
 		inline std::string reportSSLError(const std::string& errorPosition, int32_t errorValue = 0, SSL* ssl = nullptr) {
 			std::stringstream stream{};
 			stream << errorPosition << " Error: ";
@@ -178,7 +189,9 @@ namespace DiscordCoreAPI {
 			struct SSLDeleter {
 				inline void operator()(SSL* other) {
 					if (other) {
-						SSL_shutdown(other);
+						if (SSL_is_init_finished(other)) {
+							SSL_shutdown(other);
+						}
 						SSL_free(other);
 						other = nullptr;
 					}
@@ -276,10 +289,96 @@ namespace DiscordCoreAPI {
 			addrinfo* ptr{ &value };
 		};
 
+		/// @brief Holds TLS sessions (session tickets, or TLS 1.3 PSKs) per host, so that reconnecting to a host can resume rather than paying
+		/// for a full handshake. Each session is handed out once, as RFC 8446 recommends, and every connection tops the cache back up with the
+		/// tickets that its server sends it.
+		class TlsSessionCache {
+		  public:
+			static constexpr uint64_t maxSessionsPerHost{ 8 };
+
+			/// @brief Takes a resumable session for a host, if there is one.
+			/// @param host The host to collect a session for.
+			/// @return The session, which the caller owns a reference to - or nullptr.
+			inline static SSL_SESSION* takeSession(const std::string& host) {
+				std::unique_lock lock{ accessMutex };
+				if (!sessions.contains(host)) {
+					return nullptr;
+				}
+				auto& hostSessions = sessions[host];
+				while (!hostSessions.empty()) {
+					SSL_SESSION* session{ hostSessions.back() };
+					hostSessions.pop_back();
+					if (SSL_SESSION_is_resumable(session)) {
+						return session;
+					}
+					SSL_SESSION_free(session);
+				}
+				return nullptr;
+			}
+
+			/// @brief Records whether a completed handshake resumed a session - and hands a resumed session back, below TLS 1.3, where the
+			/// server does not replace it with a new ticket and it may safely be used again.
+			/// @param ssl The connection whose handshake has completed.
+			inline static void recordHandshake(SSL* ssl) {
+				if (SSL_session_reused(ssl)) {
+					resumedHandshakeCount.fetch_add(1, std::memory_order_relaxed);
+					if (SSL_version(ssl) < TLS1_3_VERSION) {
+						SSL_SESSION* session{ SSL_get1_session(ssl) };
+						if (session && !storeSession(ssl, session)) {
+							SSL_SESSION_free(session);
+						}
+					}
+				} else {
+					fullHandshakeCount.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+
+			/// @brief Collects the number of handshakes that resumed a cached session.
+			/// @return The number of handshakes.
+			inline static uint64_t getResumedHandshakeCount() {
+				return resumedHandshakeCount.load(std::memory_order_relaxed);
+			}
+
+			/// @brief Collects the number of handshakes that had to be done in full.
+			/// @return The number of handshakes.
+			inline static uint64_t getFullHandshakeCount() {
+				return fullHandshakeCount.load(std::memory_order_relaxed);
+			}
+
+			/// @brief The callback that OpenSSL hands each new session to.
+			inline static int32_t onNewSession(SSL* ssl, SSL_SESSION* session) {
+				return storeSession(ssl, session) ? 1 : 0;
+			}
+
+		  protected:
+			inline static UnorderedMap<std::string, std::deque<SSL_SESSION*>> sessions{};
+			inline static std::atomic_uint64_t resumedHandshakeCount{};
+			inline static std::atomic_uint64_t fullHandshakeCount{};
+			inline static std::mutex accessMutex{};
+
+			/// @brief Caches a session under the connection's SNI host name, evicting the host's oldest session if it is full.
+			/// @param ssl The connection that the session belongs to.
+			/// @param session The session, whose reference the cache takes over if it is stored.
+			/// @return True if the session was stored.
+			inline static bool storeSession(SSL* ssl, SSL_SESSION* session) {
+				const char* host{ SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name) };
+				if (!host) {
+					return false;
+				}
+				std::unique_lock lock{ accessMutex };
+				auto& hostSessions = sessions[std::string{ host }];
+				if (hostSessions.size() >= maxSessionsPerHost) {
+					SSL_SESSION_free(hostSessions.front());
+					hostSessions.pop_front();
+				}
+				hostSessions.emplace_back(session);
+				return true;
+			}
+		};
+
 		class SSLContextHolder {
 		  public:
 			inline static SSL_CTXWrapper context{};
-			inline static std::mutex accessMutex{};
 
 			inline static bool initialize() {
 				if (SSLContextHolder::context = SSL_CTX_new(TLS_client_method()); !SSLContextHolder::context) {
@@ -290,6 +389,9 @@ namespace DiscordCoreAPI {
 					return false;
 				}
 
+				SSL_CTX_set_session_cache_mode(SSLContextHolder::context, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+				SSL_CTX_sess_set_new_cb(SSLContextHolder::context, &TlsSessionCache::onNewSession);
+
 #ifdef SSL_OP_IGNORE_UNEXPECTED_EOF
 				auto originalOptions{ SSL_CTX_get_options(SSLContextHolder::context) | SSL_OP_IGNORE_UNEXPECTED_EOF };
 				if (SSL_CTX_set_options(SSLContextHolder::context, SSL_OP_IGNORE_UNEXPECTED_EOF) != originalOptions) {
@@ -300,6 +402,207 @@ namespace DiscordCoreAPI {
 			}
 		};
 
+		/// @brief A resolved address, in the form that connect() takes it.
+		struct ResolvedAddress {
+			sockaddr_storage address{};
+			socklen_t addressLength{};
+			int32_t family{};
+		};
+
+		/// @brief Caches getaddrinfo() results per host and port. getaddrinfo() does not report record TTLs, so entries are served for a fixed
+		/// time-to-live, and are re-resolved in the background once they are past half of it - so a hot host never waits on DNS.
+		class DnsCache {
+		  public:
+			static constexpr Milliseconds timeToLive{ 300000 };
+
+			/// @brief Collects the addresses of a host, resolving them if they are not already cached.
+			/// @param host The host to resolve.
+			/// @param port The port to resolve it for.
+			/// @return The addresses, ordered for happy-eyeballs connection attempts - or empty if the lookup failed.
+			inline static Jsonifier::Vector<ResolvedAddress> resolve(const std::string& host, uint16_t port) {
+				std::string key{ host + ":" + std::to_string(port) };
+				Milliseconds currentTime{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
+				std::unique_lock lock{ state.accessMutex };
+				if (state.entries.contains(key)) {
+					auto& entry = state.entries[key];
+					if (currentTime < entry.expiryTime) {
+						if (currentTime >= entry.expiryTime - timeToLive / 2 && !entry.isItRefreshing) {
+							entry.isItRefreshing = true;
+							queueRefresh(host, port);
+						}
+						return entry.addresses;
+					}
+				}
+				lock.unlock();
+				auto addresses = lookUp(host, port);
+				store(key, addresses);
+				return addresses;
+			}
+
+			/// @brief Drops a host's cached addresses - for once none of them will accept a connection.
+			/// @param host The host to drop.
+			/// @param port The port it was resolved for.
+			inline static void invalidate(const std::string& host, uint16_t port) {
+				std::unique_lock lock{ state.accessMutex };
+				state.entries.erase(host + ":" + std::to_string(port));
+			}
+
+		  protected:
+			struct Entry {
+				Jsonifier::Vector<ResolvedAddress> addresses{};
+				Milliseconds expiryTime{};
+				bool isItRefreshing{};
+			};
+
+			/// @brief Everything the cache shares - held in one object so that its refresh thread, declared last, is stopped and joined before
+			/// the rest of it is destroyed.
+			struct State {
+				std::deque<std::pair<std::string, uint16_t>> refreshQueue{};
+				UnorderedMap<std::string, Entry> entries{};
+				std::condition_variable refreshCondition{};
+				std::mutex accessMutex{};
+				ThreadWrapper refreshThread{};
+
+				inline ~State() {
+					std::unique_lock lock{ accessMutex };
+					refreshThread.requestStop();
+					lock.unlock();
+					refreshCondition.notify_all();
+				}
+			};
+
+			static State state;
+
+			/// @brief Queues a background re-resolution of a host - starting the refresh thread on first use. Must be called under the lock.
+			inline static void queueRefresh(const std::string& host, uint16_t port) {
+				state.refreshQueue.emplace_back(host, port);
+				if (!state.refreshThread.joinable()) {
+					state.refreshThread = ThreadWrapper([](StopToken stopToken) {
+						refresh(stopToken);
+					});
+				}
+				state.refreshCondition.notify_one();
+			}
+
+			inline static void refresh(StopToken stopToken) {
+				while (!stopToken.stopRequested()) {
+					std::unique_lock lock{ state.accessMutex };
+					state.refreshCondition.wait(lock, [&] {
+						return stopToken.stopRequested() || !state.refreshQueue.empty();
+					});
+					if (stopToken.stopRequested()) {
+						return;
+					}
+					auto [host, port] = std::move(state.refreshQueue.front());
+					state.refreshQueue.pop_front();
+					lock.unlock();
+					store(host + ":" + std::to_string(port), lookUp(host, port));
+				}
+			}
+
+			inline static void store(const std::string& key, Jsonifier::Vector<ResolvedAddress> addresses) {
+				std::unique_lock lock{ state.accessMutex };
+				if (addresses.empty()) {
+					if (state.entries.contains(key)) {
+						state.entries[key].isItRefreshing = false;
+					}
+					return;
+				}
+				Entry entry{};
+				entry.expiryTime = std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) + timeToLive;
+				entry.addresses = std::move(addresses);
+				state.entries[key] = std::move(entry);
+			}
+
+			/// @brief Resolves a host, interleaving the address families (starting with whichever getaddrinfo() preferred) as RFC 8305 asks.
+			inline static Jsonifier::Vector<ResolvedAddress> lookUp(const std::string& host, uint16_t port) {
+				addrinfo hints{};
+				hints.ai_family = AF_UNSPEC;
+				hints.ai_socktype = SOCK_STREAM;
+				hints.ai_protocol = IPPROTO_TCP;
+				addrinfo* results{};
+				if (getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &results) || !results) {
+					MessagePrinter::printError<PrintMessageType::WebSocket>(reportError("DnsCache::lookUp::getaddrinfo(), to: " + host));
+					return {};
+				}
+				Jsonifier::Vector<ResolvedAddress> preferred{};
+				Jsonifier::Vector<ResolvedAddress> others{};
+				int32_t preferredFamily{ results->ai_family };
+				for (addrinfo* result = results; result; result = result->ai_next) {
+					if (result->ai_addrlen > sizeof(sockaddr_storage)) {
+						continue;
+					}
+					ResolvedAddress address{};
+					std::memcpy(&address.address, result->ai_addr, result->ai_addrlen);
+					address.addressLength = static_cast<socklen_t>(result->ai_addrlen);
+					address.family = result->ai_family;
+					(result->ai_family == preferredFamily ? preferred : others).emplace_back(address);
+				}
+				freeaddrinfo(results);
+				Jsonifier::Vector<ResolvedAddress> addresses{};
+				for (uint64_t x = 0; x < preferred.size() || x < others.size(); ++x) {
+					if (x < preferred.size()) {
+						addresses.emplace_back(preferred[x]);
+					}
+					if (x < others.size()) {
+						addresses.emplace_back(others[x]);
+					}
+				}
+				return addresses;
+			}
+		};
+
+		inline DnsCache::State DnsCache::state{};
+
+		inline bool setSocketNonBlocking(SOCKET socket) {
+#ifdef _WIN32
+			u_long value{ 1 };
+			return ioctlsocket(socket, FIONBIO, &value) != SOCKET_ERROR;
+#else
+			return fcntl(socket, F_SETFL, fcntl(socket, F_GETFL, 0) | O_NONBLOCK) != SOCKET_ERROR;
+#endif
+		}
+
+		inline bool isConnectInProgress() {
+#ifdef _WIN32
+			return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+			return errno == EINPROGRESS;
+#endif
+		}
+
+		/// @brief A connection that is still being set up - its happy-eyeballs (RFC 8305) connect attempts, and then its TLS handshake.
+		struct ConnectionSetup {
+			static constexpr Milliseconds attemptDelay{ 250 };
+
+			Jsonifier::Vector<ResolvedAddress> addresses{};///< The addresses to try, in order.
+			Jsonifier::Vector<pollfd> attempts{};///< The connect attempts that are still pending.
+			SetupState state{ SetupState::Connecting };
+			Milliseconds nextAttemptTime{};///< When the next address is to be tried, if the pending attempts have not connected by then.
+			std::string addressString{};///< The host, for SNI and for the caches.
+			int16_t handshakeEvents{};///< What the handshake is waiting on the socket for.
+			Milliseconds deadline{};///< When the current stage - the connect or the handshake - times out.
+			std::string baseUrl{};
+			uint64_t nextIndex{};
+			SOCKETWrapper socket{};
+			SSLWrapper ssl{};
+			uint16_t port{};
+
+			/// @brief Closes every pending attempt but the winner, if there is one.
+			inline void closeAttempts(SOCKET winner = INVALID_SOCKET) {
+				for (auto& value: attempts) {
+					if (value.fd != winner) {
+						close(value.fd);
+					}
+				}
+				attempts.clear();
+			}
+
+			inline ~ConnectionSetup() {
+				closeAttempts();
+			}
+		};
+
 		template<typename ValueType> class SSLDataInterface {
 		  public:
 			template<typename ValueType2> friend class TCPConnection;
@@ -377,115 +680,102 @@ namespace DiscordCoreAPI {
 			TCPConnection& operator=(TCPConnection<ValueType>&& other) = default;
 			TCPConnection(TCPConnection<ValueType>&& other) = default;
 
+			/// @brief Connects and completes the TLS handshake, blocking the calling thread until both are done. If the host is not in the
+			/// DnsCache it is resolved with getaddrinfo() on this thread, and the connect and the handshake may each take up to connectTimeOut
+			/// - so this is for threads that own their connection, such as a shard's. The REST client drives beginSetup() and advanceSetup()
+			/// from its reactor instead.
+			/// @param baseUrlNew The url to connect to.
+			/// @param portNew The port to connect to.
 			inline TCPConnection(const std::string& baseUrlNew, const uint16_t portNew) {
-				std::string addressString{};
+				beginSetup(baseUrlNew, portNew);
+				Jsonifier::Vector<pollfd> polls{};
+				while (advanceSetup() != SetupState::Complete && isSetupPending()) {
+					polls.clear();
+					appendSetupPolls(polls);
+					if (poll(polls.data(), static_cast<u_long>(polls.size()), getSetupWaitTime()) == SOCKET_ERROR) {
+						failSetup("TCPConnection::connect::poll(), to: ");
+					}
+				}
+			}
+
+			/// @brief Starts connecting, without waiting on anything but a DnsCache miss - advanceSetup() then takes it the rest of the way.
+			/// @param baseUrlNew The url to connect to.
+			/// @param portNew The port to connect to.
+			inline void beginSetup(const std::string& baseUrlNew, const uint16_t portNew) {
+				setup = makeUnique<ConnectionSetup>();
 				auto httpsFind = baseUrlNew.find("https://");
 				auto comFind = baseUrlNew.find(".com");
 				auto orgFind = baseUrlNew.find(".org");
 				if (httpsFind != std::string::npos && comFind != std::string::npos) {
-					addressString = baseUrlNew.substr(httpsFind + std::string_view{ "https://" }.size(),
+					setup->addressString = baseUrlNew.substr(httpsFind + std::string_view{ "https://" }.size(),
 						comFind + std::string_view{ ".com" }.size() - std::string_view{ "https://" }.size());
 				} else if (httpsFind != std::string::npos && orgFind != std::string::npos) {
-					addressString = baseUrlNew.substr(httpsFind + std::string_view{ "https://" }.size(),
+					setup->addressString = baseUrlNew.substr(httpsFind + std::string_view{ "https://" }.size(),
 						orgFind + std::string_view{ ".org" }.size() - std::string_view{ "https://" }.size());
 				} else {
-					addressString = baseUrlNew;
+					setup->addressString = baseUrlNew;
 				}
-				addrinfoWrapper hints{}, address{};
-				hints->ai_family = AF_INET;
-				hints->ai_socktype = SOCK_STREAM;
-				hints->ai_protocol = IPPROTO_TCP;
-
-				if (getaddrinfo(addressString.c_str(), std::to_string(portNew).c_str(), hints, address)) {
-					MessagePrinter::printError<PrintMessageType::WebSocket>(reportError("TCPConnection::getaddrinfo(), to: " + baseUrlNew));
+				setup->baseUrl = baseUrlNew;
+				setup->port = portNew;
+				currentStatus = ConnectionStatus::NO_Error;
+				ssl = nullptr;
+				socket = SOCKETWrapper{};
+				setup->addresses = DnsCache::resolve(setup->addressString, portNew);
+				if (setup->addresses.empty()) {
 					currentStatus = ConnectionStatus::CONNECTION_Error;
-					socket = INVALID_SOCKET;
+					setup.reset();
 					return;
 				}
+				setup->nextAttemptTime = std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch());
+				setup->deadline = setup->nextAttemptTime + connectTimeOut;
+			}
 
-				if (socket = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol); socket.operator SOCKET() == INVALID_SOCKET) {
-					MessagePrinter::printError<PrintMessageType::WebSocket>(reportError("TCPConnection::socket(), to: " + baseUrlNew));
-					currentStatus = ConnectionStatus::CONNECTION_Error;
-					socket = INVALID_SOCKET;
-					return;
+			/// @brief Takes every step of the setup that can be taken without waiting.
+			/// @return Where the setup is - once it is Complete or Failed, there is nothing left to drive.
+			inline SetupState advanceSetup() {
+				Milliseconds currentTime{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
+				if (setup && setup->state == SetupState::Connecting) {
+					advanceConnect(currentTime);
 				}
-
-				char boolOptionVal{ static_cast<char>(true) };
-				if (setsockopt(socket, SOL_SOCKET, SO_KEEPALIVE, &boolOptionVal, sizeof(int32_t))) {
-					MessagePrinter::printError<PrintMessageType::WebSocket>(reportError("TCPConnection::setsockopt(), to: " + baseUrlNew));
-					currentStatus = ConnectionStatus::CONNECTION_Error;
-					socket = INVALID_SOCKET;
-					return;
+				if (setup && setup->state == SetupState::Handshaking) {
+					advanceHandshake(currentTime);
 				}
-
-				if (::connect(socket, address->ai_addr, static_cast<int32_t>(address->ai_addrlen)) == SOCKET_ERROR) {
-					MessagePrinter::printError<PrintMessageType::WebSocket>(reportError("TCPConnection::connect(), to: " + baseUrlNew));
-					currentStatus = ConnectionStatus::CONNECTION_Error;
-					socket = INVALID_SOCKET;
-					return;
+				if (setup) {
+					return setup->state;
 				}
+				return currentStatus == ConnectionStatus::NO_Error && ssl ? SetupState::Complete : SetupState::Failed;
+			}
 
-				std::unique_lock lock{ SSLContextHolder::accessMutex };
-				if (ssl = SSL_new(SSLContextHolder::context); !ssl) {
-					MessagePrinter::printError<PrintMessageType::WebSocket>(reportSSLError("TCPConnection::connect::SSL_new(), to: " + baseUrlNew) +
-						"\n" + reportError("TCPConnection::connect::SSL_new(), to: " + baseUrlNew));
-					currentStatus = ConnectionStatus::CONNECTION_Error;
-					socket = INVALID_SOCKET;
-					ssl = nullptr;
-					return;
-				}
-				lock.unlock();
-
-				if (auto result{ SSL_set_fd(ssl, socket) }; result != 1) {
-					MessagePrinter::printError<PrintMessageType::WebSocket>(
-						reportSSLError("TCPConnection::connect::SSL_set_fd(), to: " + baseUrlNew) + "\n" +
-						reportError("TCPConnection::connect::SSL_set_fd(), to: " + baseUrlNew));
-					currentStatus = ConnectionStatus::CONNECTION_Error;
-					socket = INVALID_SOCKET;
-					ssl = nullptr;
+			/// @brief Collects what the setup is waiting on, for polling alongside other connections.
+			/// @param polls The set to add the setup's sockets to.
+			inline void appendSetupPolls(Jsonifier::Vector<pollfd>& polls) {
+				if (!setup) {
 					return;
+				} else if (setup->state == SetupState::Connecting) {
+					polls.insert(polls.end(), setup->attempts.begin(), setup->attempts.end());
+				} else {
+					pollfd readWriteSet{};
+					readWriteSet.fd = static_cast<SOCKET>(setup->socket);
+					readWriteSet.events = setup->handshakeEvents;
+					polls.emplace_back(readWriteSet);
 				}
+			}
 
-				/* SNI */
-				if (auto result{ SSL_set_tlsext_host_name(ssl, addressString.c_str()) }; result != 1) {
-					MessagePrinter::printError<PrintMessageType::WebSocket>(
-						reportSSLError("TCPConnection::connect::SSL_set_tlsext_host_name(), to: " + baseUrlNew) + "\n" +
-						reportError("TCPConnection::connect::SSL_set_tlsext_host_name(), to: " + baseUrlNew));
-					currentStatus = ConnectionStatus::CONNECTION_Error;
-					socket = INVALID_SOCKET;
-					ssl = nullptr;
-					return;
+			/// @brief How long the setup can be left before it needs advancing, if none of its sockets become ready first.
+			inline int32_t getSetupWaitTime() {
+				if (!setup) {
+					return 0;
 				}
-
-				if (auto result{ SSL_connect(ssl) }; result != 1) {
-					MessagePrinter::printError<PrintMessageType::WebSocket>(
-						reportSSLError("TCPConnection::connect::SSL_connect(), to: " + baseUrlNew) + "\n" +
-						reportError("TCPConnection::connect::SSL_connect(), to: " + baseUrlNew));
-					currentStatus = ConnectionStatus::CONNECTION_Error;
-					socket = INVALID_SOCKET;
-					ssl = nullptr;
-					return;
+				Milliseconds currentTime{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
+				Milliseconds waitTime{ setup->deadline - currentTime };
+				if (setup->state == SetupState::Connecting && setup->nextIndex < setup->addresses.size()) {
+					waitTime = std::min(waitTime, setup->nextAttemptTime - currentTime);
 				}
+				return static_cast<int32_t>(std::max<int64_t>(waitTime.count(), 0));
+			}
 
-#ifdef _WIN32
-				u_long value02{ 1 };
-				if (auto returnData{ ioctlsocket(socket, FIONBIO, &value02) }; returnData == SOCKET_ERROR) {
-					MessagePrinter::printError<PrintMessageType::WebSocket>(reportError("TCPConnection::connect::ioctlsocket(), to: " + baseUrlNew));
-					currentStatus = ConnectionStatus::CONNECTION_Error;
-					socket = INVALID_SOCKET;
-					ssl = nullptr;
-					return;
-				}
-#else
-				if (auto returnData{ fcntl(socket, F_SETFL, fcntl(socket, F_GETFL, 0) | O_NONBLOCK) }; returnData == SOCKET_ERROR) {
-					MessagePrinter::printError<PrintMessageType::WebSocket>(reportError("TCPConnection::connect::fcntl(), to: " + baseUrlNew));
-					currentStatus = ConnectionStatus::CONNECTION_Error;
-					socket = INVALID_SOCKET;
-					ssl = nullptr;
-					return;
-				}
-#endif
-				currentStatus = ConnectionStatus::NO_Error;
+			inline bool isSetupPending() {
+				return setup;
 			}
 
 			inline ConnectionStatus processIO(int32_t waitTimeInMs) {
@@ -648,7 +938,8 @@ namespace DiscordCoreAPI {
 				return true;
 			}
 
-			template<typename ValueType2> inline static UnorderedMap<uint64_t, ValueType2*> processIO(UnorderedMap<uint64_t, ValueType2*>& shardMap) {
+			template<typename ValueType2>
+			inline static UnorderedMap<uint64_t, ValueType2*> processIO(UnorderedMap<uint64_t, ValueType2*>& shardMap, int32_t waitTimeInMs = 1) {
 				UnorderedMap<uint64_t, ValueType2*> returnData{};
 				PollFDWrapper readWriteSet{};
 				for (auto& [key, value]: shardMap) {
@@ -671,7 +962,7 @@ namespace DiscordCoreAPI {
 				if (readWriteSet.polls.size() == 0) {
 					return returnData;
 				}
-				if (auto returnDataNew = poll(readWriteSet.polls.data(), static_cast<u_long>(readWriteSet.polls.size()), 1);
+				if (auto returnDataNew = poll(readWriteSet.polls.data(), static_cast<u_long>(readWriteSet.polls.size()), waitTimeInMs);
 					returnDataNew == SOCKET_ERROR) {
 					bool didWeFindTheSocket{};
 					for (uint64_t x = 0; x < readWriteSet.polls.size(); ++x) {
@@ -737,6 +1028,7 @@ namespace DiscordCoreAPI {
 
 			inline void disconnect() {
 				currentStatus = ConnectionStatus::CONNECTION_Error;
+				setup.reset();
 				static_cast<ValueType*>(this)->reset();
 				socket = INVALID_SOCKET;
 				ssl = nullptr;
@@ -745,7 +1037,127 @@ namespace DiscordCoreAPI {
 			inline virtual ~TCPConnection() = default;
 
 		  protected:
+			static constexpr Milliseconds connectTimeOut{ 10000 };
+
 			inline TCPConnection() = default;
+
+			UniquePtr<ConnectionSetup> setup{};
+
+			inline void failSetup(const std::string& errorPosition) {
+				std::string errorMessage{ reportError(errorPosition + setup->baseUrl) };
+				if (setup->ssl) {
+					errorMessage = reportSSLError(errorPosition + setup->baseUrl) + "\n" + errorMessage;
+				}
+				MessagePrinter::printError<PrintMessageType::WebSocket>(errorMessage);
+				currentStatus = ConnectionStatus::CONNECTION_Error;
+				setup.reset();
+			}
+
+			/// @brief Checks the pending connect attempts, and starts the next one every attemptDelay while none of them has connected.
+			inline void advanceConnect(Milliseconds currentTime) {
+				if (!setup->attempts.empty()) {
+					if (poll(setup->attempts.data(), static_cast<u_long>(setup->attempts.size()), 0) == SOCKET_ERROR) {
+						return failSetup("TCPConnection::connect::poll(), to: ");
+					}
+					for (uint64_t x = 0; x < setup->attempts.size();) {
+						if (setup->attempts[x].revents) {
+							int32_t errorValue{};
+							socklen_t errorLength{ sizeof(errorValue) };
+							getsockopt(setup->attempts[x].fd, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&errorValue), &errorLength);
+							if (errorValue == 0 && (setup->attempts[x].revents & POLLOUT)) {
+								return startHandshake(setup->attempts[x].fd, currentTime);
+							}
+							close(setup->attempts[x].fd);
+							setup->attempts.erase(setup->attempts.begin() + static_cast<int64_t>(x));
+							setup->nextAttemptTime = currentTime;
+						} else {
+							++x;
+						}
+					}
+				}
+				while (setup->nextIndex < setup->addresses.size() && (setup->attempts.empty() || currentTime >= setup->nextAttemptTime)) {
+					auto& address = setup->addresses[setup->nextIndex++];
+					SOCKET newSocket = ::socket(address.family, SOCK_STREAM, IPPROTO_TCP);
+					if (newSocket == INVALID_SOCKET) {
+						continue;
+					}
+					if (!setSocketNonBlocking(newSocket)) {
+						close(newSocket);
+						continue;
+					}
+					pollfd attempt{};
+					attempt.fd = newSocket;
+					attempt.events = POLLOUT;
+					if (::connect(newSocket, reinterpret_cast<const sockaddr*>(&address.address), address.addressLength) == 0) {
+						setup->attempts.emplace_back(attempt);
+						return startHandshake(newSocket, currentTime);
+					} else if (!isConnectInProgress()) {
+						close(newSocket);
+						continue;
+					}
+					setup->nextAttemptTime = currentTime + ConnectionSetup::attemptDelay;
+					setup->attempts.emplace_back(attempt);
+				}
+				if (setup->attempts.empty() || currentTime >= setup->deadline) {
+					DnsCache::invalidate(setup->addressString, setup->port);
+					failSetup("TCPConnection::connect(), to: ");
+				}
+			}
+
+			/// @brief Takes the connected socket, and readies the TLS handshake on it - resuming a cached session where there is one.
+			inline void startHandshake(SOCKET winner, Milliseconds currentTime) {
+				setup->closeAttempts(winner);
+				setup->socket = winner;
+				char boolOptionVal{ static_cast<char>(true) };
+				if (setsockopt(winner, SOL_SOCKET, SO_KEEPALIVE, &boolOptionVal, sizeof(int32_t))) {
+					return failSetup("TCPConnection::setsockopt(), to: ");
+				}
+				if (setup->ssl = SSL_new(SSLContextHolder::context); !setup->ssl) {
+					return failSetup("TCPConnection::connect::SSL_new(), to: ");
+				}
+				if (auto result{ SSL_set_fd(setup->ssl, winner) }; result != 1) {
+					return failSetup("TCPConnection::connect::SSL_set_fd(), to: ");
+				}
+				/* SNI */
+				if (auto result{ SSL_set_tlsext_host_name(setup->ssl, setup->addressString.c_str()) }; result != 1) {
+					return failSetup("TCPConnection::connect::SSL_set_tlsext_host_name(), to: ");
+				}
+				if (SSL_SESSION* session{ TlsSessionCache::takeSession(setup->addressString) }) {
+					SSL_set_session(setup->ssl, session);
+					SSL_SESSION_free(session);
+				}
+				setup->state = SetupState::Handshaking;
+				setup->deadline = currentTime + connectTimeOut;
+			}
+
+			/// @brief Runs SSL_connect() as far as it goes without waiting, and hands the socket and the session over once it is done.
+			inline void advanceHandshake(Milliseconds currentTime) {
+				auto result{ SSL_connect(setup->ssl) };
+				if (result == 1) {
+					TlsSessionCache::recordHandshake(setup->ssl);
+					socket = std::move(setup->socket);
+					ssl = std::move(setup->ssl);
+					currentStatus = ConnectionStatus::NO_Error;
+					setup.reset();
+					return;
+				}
+				switch (SSL_get_error(setup->ssl, result)) {
+					case SSL_ERROR_WANT_READ: {
+						setup->handshakeEvents = POLLIN;
+						break;
+					}
+					case SSL_ERROR_WANT_WRITE: {
+						setup->handshakeEvents = POLLOUT;
+						break;
+					}
+					default: {
+						return failSetup("TCPConnection::connect::SSL_connect(), to: ");
+					}
+				}
+				if (currentTime >= setup->deadline) {
+					failSetup("TCPConnection::connect::SSL_connect(), to: ");
+				}
+			}
 		};
 	}
 
@@ -0,0 +1,280 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// TimerWheel.hpp - Header file for the "TimerWheel" stuff.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file TimerWheel.hpp
+
+#pragma once
+
+#include <discordcoreapi/Utilities/Base.hpp>
+#include <discordcoreapi/Utilities/ThreadWrapper.hpp>
+#include <discordcoreapi/Utilities/UnorderedMap.hpp>
+#include <condition_variable>
+
+namespace DiscordCoreAPI {
+
+	namespace DiscordCoreInternal {
+
+		/**
+		* \addtogroup discord_core_internal
+		* @{
+		*/
+
+		using TimerCallback = std::function<void()>;
+
+		/// @brief A hierarchical timing wheel - for running callbacks after a delay, or on an interval, from a single thread.
+		/// @details Four levels of 64 one-millisecond-granularity slots cover roughly 4.6 hours, and longer delays are re-cascaded from the top
+		/// level. Inserting and cancelling a timer are both O(1), and the thread sleeps until the next slot that has work in it - so idle
+		/// timers cost nothing. Callbacks are run on the wheel's thread, and so should hand any real work off elsewhere.
+		class TimerWheel {
+		  public:
+			static constexpr uint64_t slotBits{ 6 };
+			static constexpr uint64_t slotCount{ 1ull << slotBits };
+			static constexpr uint64_t levelCount{ 4 };
+
+			/// @brief Constructor for the TimerWheel - launches its thread.
+			inline TimerWheel() {
+				thread = ThreadWrapper([this](StopToken stopToken) {
+					run(stopToken);
+				});
+			}
+
+			inline TimerWheel& operator=(const TimerWheel&) = delete;
+			inline TimerWheel(const TimerWheel&) = delete;
+
+			/// @brief Schedules a callback to be run after a delay.
+			/// @param timeDelay The delay to wait before running the callback.
+			/// @param callback The callback to run.
+			/// @param repeatInterval If non-zero, the interval at which to keep re-running the callback, until it is cancelled.
+			/// @return A timer id, for cancelling the timer.
+			inline uint64_t schedule(Milliseconds timeDelay, TimerCallback callback, Milliseconds repeatInterval = Milliseconds{}) {
+				std::unique_lock lock{ accessMutex };
+				UniquePtr<TimerNode> timerNode{ makeUnique<TimerNode>() };
+				timerNode->timerId = ++currentTimerId;
+				timerNode->callback = std::move(callback);
+				timerNode->repeatInterval = static_cast<uint64_t>(std::max<int64_t>(repeatInterval.count(), 0));
+				timerNode->expiryTick = getCurrentTick() + static_cast<uint64_t>(std::max<int64_t>(timeDelay.count(), 0)) + 1;
+				insertNode(timerNode.get(), currentTick + 1);
+				uint64_t timerId{ timerNode->timerId };
+				timerNodes.emplace(timerId, std::move(timerNode));
+				lock.unlock();
+				wakeCondition.notify_one();
+				return timerId;
+			}
+
+			/// @brief Cancels a timer, if it has not yet run (or, for a repeating timer, stops any further runs).
+			/// @param timerId The id that was returned by schedule().
+			/// @return True if the timer was found and cancelled.
+			inline bool cancel(uint64_t timerId) {
+				std::unique_lock lock{ accessMutex };
+				if (!timerNodes.contains(timerId)) {
+					return false;
+				}
+				unlinkNode(timerNodes[timerId].get());
+				timerNodes.erase(timerId);
+				return true;
+			}
+
+			/// @brief Collects the number of timers that are currently scheduled.
+			/// @return The number of timers.
+			inline uint64_t size() {
+				std::unique_lock lock{ accessMutex };
+				return timerNodes.size();
+			}
+
+			inline ~TimerWheel() {
+				std::unique_lock lock{ accessMutex };
+				thread.requestStop();
+				lock.unlock();
+				wakeCondition.notify_all();
+			}
+
+		  protected:
+			struct TimerNode {
+				TimerNode* previous{};
+				TimerCallback callback{};
+				uint64_t repeatInterval{};
+				uint64_t expiryTick{};
+				TimerNode* next{};
+				uint64_t timerId{};
+				uint64_t level{};
+				uint64_t slot{};
+			};
+
+			std::chrono::steady_clock::time_point startTime{ std::chrono::steady_clock::now() };
+			std::array<std::array<TimerNode*, slotCount>, levelCount> slots{};
+			UnorderedMap<uint64_t, UniquePtr<TimerNode>> timerNodes{};
+			std::condition_variable wakeCondition{};
+			uint64_t currentTimerId{};
+			std::mutex accessMutex{};
+			uint64_t currentTick{};
+			ThreadWrapper thread{};
+
+			inline uint64_t getCurrentTick() const {
+				return static_cast<uint64_t>(std::chrono::duration_cast<Milliseconds>(std::chrono::steady_clock::now() - startTime).count());
+			}
+
+			/// @brief Places a node into the level whose span covers its remaining delay.
+			/// @param timerNode The node to insert.
+			/// @param earliestTick The earliest tick whose slot has not been processed yet.
+			inline void insertNode(TimerNode* timerNode, uint64_t earliestTick) {
+				uint64_t targetTick{ std::max(timerNode->expiryTick, earliestTick) };
+				uint64_t delta{ targetTick - currentTick };
+				uint64_t level{};
+				while (level < levelCount - 1 && delta >= (1ull << (slotBits * (level + 1)))) {
+					++level;
+				}
+				uint64_t maxDelta{ (1ull << (slotBits * levelCount)) - 1 };
+				if (delta > maxDelta) {
+					targetTick = currentTick + maxDelta;
+				}
+				timerNode->level = level;
+				timerNode->slot = (targetTick >> (slotBits * level)) & (slotCount - 1);
+				timerNode->previous = nullptr;
+				timerNode->next = slots[level][timerNode->slot];
+				if (timerNode->next) {
+					timerNode->next->previous = timerNode;
+				}
+				slots[level][timerNode->slot] = timerNode;
+			}
+
+			inline void unlinkNode(TimerNode* timerNode) {
+				if (timerNode->previous) {
+					timerNode->previous->next = timerNode->next;
+				} else {
+					slots[timerNode->level][timerNode->slot] = timerNode->next;
+				}
+				if (timerNode->next) {
+					timerNode->next->previous = timerNode->previous;
+				}
+				timerNode->previous = nullptr;
+				timerNode->next = nullptr;
+			}
+
+			/// @brief Collects the next tick at which a slot either fires or cascades.
+			/// @return The tick - or the maximum value, if there are no timers.
+			inline uint64_t getNextEventTick() const {
+				uint64_t nextEventTick{ std::numeric_limits<uint64_t>::max() };
+				for (uint64_t level = 0; level < levelCount; ++level) {
+					uint64_t levelShift{ slotBits * level };
+					for (uint64_t x = 1; x <= slotCount; ++x) {
+						uint64_t slotTick{ ((currentTick >> levelShift) + x) << levelShift };
+						if (slots[level][((currentTick >> levelShift) + x) & (slotCount - 1)]) {
+							nextEventTick = std::min(nextEventTick, slotTick);
+							break;
+						}
+					}
+				}
+				return nextEventTick;
+			}
+
+			/// @brief Moves every node out of the higher-level slots that currentTick has just reached, into lower levels.
+			inline void cascade() {
+				for (uint64_t level = levelCount - 1; level > 0; --level) {
+					uint64_t levelShift{ slotBits * level };
+					if ((currentTick & ((1ull << levelShift) - 1)) != 0) {
+						continue;
+					}
+					TimerNode* timerNode{ slots[level][(currentTick >> levelShift) & (slotCount - 1)] };
+					slots[level][(currentTick >> levelShift) & (slotCount - 1)] = nullptr;
+					while (timerNode) {
+						TimerNode* nextNode{ timerNode->next };
+						insertNode(timerNode, currentTick);
+						timerNode = nextNode;
+					}
+				}
+			}
+
+			/// @brief Advances the wheel up to the present, collecting the callbacks of every timer that has expired.
+			/// @param callbacks The container to collect the callbacks into.
+			inline void advance(Jsonifier::Vector<TimerCallback>& callbacks) {
+				uint64_t nowTick{ getCurrentTick() };
+				while (currentTick < nowTick) {
+					uint64_t nextEventTick{ getNextEventTick() };
+					if (nextEventTick > nowTick) {
+						currentTick = nowTick;
+						return;
+					}
+					currentTick = nextEventTick;
+					cascade();
+					TimerNode* timerNode{ slots[0][currentTick & (slotCount - 1)] };
+					slots[0][currentTick & (slotCount - 1)] = nullptr;
+					while (timerNode) {
+						TimerNode* nextNode{ timerNode->next };
+						if (timerNode->expiryTick > currentTick) {
+							insertNode(timerNode, currentTick + 1);
+						} else if (timerNode->repeatInterval > 0) {
+							callbacks.emplace_back(timerNode->callback);
+							timerNode->expiryTick = currentTick + timerNode->repeatInterval;
+							insertNode(timerNode, currentTick + 1);
+						} else {
+							callbacks.emplace_back(std::move(timerNode->callback));
+							timerNodes.erase(timerNode->timerId);
+						}
+						timerNode = nextNode;
+					}
+				}
+			}
+
+			/// @brief The wheel's thread - sleeps until the next event, then runs whichever callbacks have come due.
+			/// @param stopToken The stop token for the thread.
+			inline void run(StopToken stopToken) {
+				Jsonifier::Vector<TimerCallback> callbacks{};
+				while (!stopToken.stopRequested()) {
+					std::unique_lock lock{ accessMutex };
+					if (stopToken.stopRequested()) {
+						return;
+					}
+					advance(callbacks);
+					if (callbacks.size() == 0) {
+						uint64_t nextEventTick{ getNextEventTick() };
+						if (nextEventTick == std::numeric_limits<uint64_t>::max()) {
+							wakeCondition.wait(lock);
+						} else {
+							wakeCondition.wait_until(lock, startTime + Milliseconds{ nextEventTick });
+						}
+						continue;
+					}
+					lock.unlock();
+					for (auto& value: callbacks) {
+						try {
+							value();
+						} catch (const DCAException& error) {
+							MessagePrinter::printError<PrintMessageType::General>(error.what());
+						} catch (const std::exception& error) {
+							MessagePrinter::printError<PrintMessageType::General>(std::string{ "TimerWheel callback threw: " } + error.what());
+						} catch (...) {
+							MessagePrinter::printError<PrintMessageType::General>("TimerWheel callback threw an unknown exception.");
+						}
+					}
+					callbacks.clear();
+				}
+			}
+		};
+		/**@}*/
+	}
+}
@@ -35,6 +35,7 @@
 namespace DiscordCoreAPI {
 
 	/// @brief A thread-safe messaging block for data-structures.
+	/// @details Receivers that want to wait for an object park on a semaphore, which is released once per sent object, rather than polling.
 	/// @tparam ValueType The type of object that will be sent over the message block.
 	template<CopyableOrMovable ValueType> class UnboundedMessageBlock {
 	  public:
@@ -46,6 +47,12 @@ namespace DiscordCoreAPI {
 				std::unique_lock lock{ accessMutex, std::adopt_lock };
 				std::unique_lock otherLock{ other.accessMutex, std::adopt_lock };
 				queue = std::move(other.queue);
+				other.queue.clear();
+				while (itemCount.try_acquire()) {
+				}
+				while (other.itemCount.try_acquire()) {
+				}
+				itemCount.release(static_cast<std::ptrdiff_t>(queue.size()));
 			}
 			return *this;
 		}
@@ -58,22 +65,60 @@ namespace DiscordCoreAPI {
 		template<typename ValueTypeNew> inline void send(ValueTypeNew&& object) {
 			std::unique_lock lock{ accessMutex };
 			queue.emplace_back(std::forward<ValueTypeNew>(object));
+			itemCount.release();
 		}
 
+		/// @brief Removes every queued object, along with the semaphore units that were released for them.
 		inline void clearContents() {
 			std::unique_lock lock{ accessMutex };
+			for (uint64_t x = 0; x < queue.size() && itemCount.try_acquire(); ++x) {
+			}
 			queue.clear();
 		}
 
 		inline bool tryReceive(ValueType& object) {
+			return itemCount.try_acquire() && popFront(object);
+		}
+
+		/// @brief Receives an object, parking the calling thread until one is available.
+		/// @param object The object to receive into.
+		inline void receive(ValueType& object) {
+			do {
+				itemCount.acquire();
+			} while (!popFront(object));
+		}
+
+		/// @brief Receives an object, parking the calling thread until one is available or the timeout elapses.
+		/// @param object The object to receive into.
+		/// @param timeOut The maximum time to wait for.
+		/// @return True if an object was received, false if the timeout elapsed.
+		template<typename RepType, typename PeriodType> inline bool receiveFor(ValueType& object, std::chrono::duration<RepType, PeriodType> timeOut) {
+			auto deadline = std::chrono::steady_clock::now() + timeOut;
+			do {
+				if (!itemCount.try_acquire_until(deadline)) {
+					return false;
+				}
+			} while (!popFront(object));
+			return true;
+		}
+
+		/// @brief Receives as many objects as are available, up to a limit, under a single lock.
+		/// @param objects A container to append the received objects to.
+		/// @param maxCount The maximum number of objects to receive.
+		/// @return The number of objects that were received.
+		template<typename ContainerType> inline uint64_t tryReceiveMany(ContainerType& objects, uint64_t maxCount) {
+			uint64_t acquiredCount{};
+			while (acquiredCount < maxCount && itemCount.try_acquire()) {
+				++acquiredCount;
+			}
 			std::unique_lock lock{ accessMutex };
-			if (queue.size() > 0) {
-				object = std::move(queue.front());
+			uint64_t receivedCount{};
+			while (receivedCount < acquiredCount && queue.size() > 0) {
+				objects.emplace_back(std::move(queue.front()));
 				queue.pop_front();
-				return true;
-			} else {
-				return false;
+				++receivedCount;
 			}
+			return receivedCount;
 		}
 
 		inline uint64_t size() {
@@ -83,19 +128,25 @@ namespace DiscordCoreAPI {
 
 	  protected:
 		std::deque<std::decay_t<ValueType>> queue{};
+		std::counting_semaphore<> itemCount{ 0 };
 		std::mutex accessMutex{};
+
+		/// @brief Takes the object at the front of the queue - which clearContents() may have removed after the caller acquired its unit.
+		inline bool popFront(ValueType& object) {
+			std::unique_lock lock{ accessMutex };
+			if (queue.size() > 0) {
+				object = std::move(queue.front());
+				queue.pop_front();
+				return true;
+			} else {
+				return false;
+			}
+		}
 	};
 
 	template<typename ValueType>
 	inline bool waitForTimeToPass(UnboundedMessageBlock<std::decay_t<ValueType>>& outBuffer, ValueType& argOne, uint64_t timeInMsNew) {
-		StopWatch<std::chrono::milliseconds> stopWatchNew{ Milliseconds{ timeInMsNew } };
-		while (!outBuffer.tryReceive(argOne)) {
-			std::this_thread::sleep_for(1ms);
-			if (stopWatchNew.hasTimePassed()) {
-				return true;
-			}
-		};
-		return false;
+		return !outBuffer.receiveFor(argOne, Milliseconds{ timeInMsNew });
 	}
 
 }
@@ -36,6 +36,8 @@
 #include <discordcoreapi/Utilities/ObjectCache.hpp>
 #include <discordcoreapi/Utilities/RingBuffer.hpp>
 #include <discordcoreapi/Utilities/UnboundedMessageBlock.hpp>
+#include <discordcoreapi/Utilities/BoundedMessageBlock.hpp>
+#include <discordcoreapi/Utilities/MPMCQueue.hpp>
 #include <discordcoreapi/Utilities/Etf.hpp>
 #include <coroutine>
 
@@ -78,6 +80,7 @@ namespace DiscordCoreAPI {
 
 	namespace DiscordCoreInternal {
 
+		enum class HttpsWorkloadType : uint8_t;
 		class SoundCloudRequestBuilder;
 		class YouTubeRequestBuilder;
 		class WebSocketClient;
@@ -222,6 +225,47 @@ namespace DiscordCoreAPI {
 		bool cacheUsers{ true };///< Do we cache Users?
 	};
 
+	/// @brief Audio options for the library.
+	struct AudioOptions {
+		uint32_t bufferDepthInMs{ 2000 };///< How many milliseconds of audio may be buffered ahead of playback, per Guild.
+		uint32_t prefetchAfterInMs{ 5000 };///< How far into a Song the next one starts prefetching - 0 waits for the current one to finish downloading.
+		uint64_t cacheSizeBudgetInBytes{ 1024ull * 1024ull * 1024ull };///< The maximum combined size of the on-disk audio cache.
+		std::string cacheDirectory{};///< Where to cache the demuxed audio of played Songs - leave empty to disable the cache.
+	};
+
+	/// @brief Options for registering the bot's application commands at startup.
+	struct CommandRegistrationOptions {
+		std::string stateFilePath{};///< Where to store the hashes of the last-applied command sets, so that an unchanged startup makes no calls.
+		bool bulkOverwrite{};///< Replace each scope's commands in a single bulk overwrite, when they differ - removes commands not registered locally.
+	};
+
+	/// @brief The priority lanes that REST requests queue in - lower lanes go first wherever requests compete.
+	enum class RestLane : uint8_t {
+		Urgent = 0,///< Interaction responses and follow-ups, which Discord expires, and the gateway lookup that connecting depends on.
+		Normal = 1,///< Everything not in another lane.
+		Deferrable = 2,///< Bulk and background calls, which yield to every other lane.
+		LAST = 3
+	};
+
+	/// @brief Queue latency statistics for one RestLane.
+	struct RestLaneStats {
+		Milliseconds totalQueueLatency{};///< The combined time that the lane's requests spent queued before being sent.
+		Milliseconds maxQueueLatency{};///< The longest time that one of the lane's requests spent queued.
+		uint64_t requestCount{};///< The number of the lane's requests that have been sent.
+	};
+
+	/// @brief Counts of the TLS handshakes that the library's connections have completed.
+	struct TlsHandshakeStats {
+		uint64_t resumedHandshakeCount{};///< The handshakes that resumed a cached session.
+		uint64_t fullHandshakeCount{};///< The handshakes that had to be done in full.
+	};
+
+	/// @brief Options for the library's REST client.
+	struct RestOptions {
+		UnorderedMap<DiscordCoreInternal::HttpsWorkloadType, uint32_t>
+			responseCacheTtlsInMs{};///< How long a successful GET response of each workload type may be reused for - absent types are never cached.
+	};
+
 	/// @brief Configuration data for the library's main class, DiscordCoreClient.
 	struct DiscordCoreClientConfig {
 		UpdatePresenceData presenceData{ PresenceUpdateState::Online };///< Presence data to initialize your bot with.
@@ -231,6 +275,9 @@ namespace DiscordCoreAPI {
 		std::string connectionAddress{};///< A potentially alternative connection address for the websocket.
 		ShardingOptions shardOptions{};///< Options for the sharding of your bot.
 		LoggingOptions logOptions{};///< Options for the output/logging of the library.
+		AudioOptions audioOptions{};///< Options for the audio playback of the library.
+		CommandRegistrationOptions commandOptions{};///< Options for the registration of application commands.
+		RestOptions restOptions{};///< Options for the REST client.
 		CacheOptions cacheOptions{};///< Options for the cache of the library.
 		uint16_t connectionPort{};///< A potentially alternative connection port for the websocket.
 		std::string botToken{};///< Your bot's token.
@@ -293,6 +340,20 @@ namespace DiscordCoreAPI {
 
 		GatewayIntents getGatewayIntents();
 
+		uint32_t getAudioBufferDepthInMs() const;
+
+		uint32_t getAudioPrefetchAfterInMs() const;
+
+		uint64_t getAudioCacheSizeBudget() const;
+
+		std::string getAudioCacheDirectory() const;
+
+		bool doWeBulkOverwriteCommands() const;
+
+		std::string getCommandStateFilePath() const;
+
+		UnorderedMap<DiscordCoreInternal::HttpsWorkloadType, uint32_t> getResponseCacheTtls() const;
+
 	  protected:
 		DiscordCoreClientConfig config{};
 	};
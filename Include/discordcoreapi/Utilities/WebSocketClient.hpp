@@ -205,6 +205,13 @@ namespace DiscordCoreAPI {
 
 			bool checkForAndSendHeartBeat(bool = false);
 
+			/// @brief Schedules a repeating TimerWheel timer that marks a heartbeat as due, every heartbeat interval.
+			/// @param heartBeatInterval The interval to send heartbeats at.
+			void startHeartBeating(Milliseconds heartBeatInterval);
+
+			/// @brief Cancels the heartbeat timer, if one is scheduled.
+			void stopHeartBeating();
+
 			void parseConnectionHeaders();
 
 			virtual void onClosed() = 0;
@@ -215,9 +222,10 @@ namespace DiscordCoreAPI {
 
 			void disconnect();
 
-			virtual ~WebSocketCore() = default;
+			virtual ~WebSocketCore();
 
 		  protected:
+			std::shared_ptr<std::atomic_bool> isHeartBeatDue{ std::make_shared<std::atomic_bool>() };///< Set from the TimerWheel, cleared on send.
 			StopWatch<Milliseconds> heartBeatStopWatch{ 20000ms };
 			std::atomic<WebSocketState> currentState{};
 			bool haveWeReceivedHeartbeatAck{ true };
@@ -228,6 +236,7 @@ namespace DiscordCoreAPI {
 			std::array<uint32_t, 2> shard{};
 			ConfigManager* configManager{};
 			uint32_t lastNumberReceived{};
+			uint64_t heartBeatTimerId{};
 			WebSocketOpCode dataOpCode{};
 			bool areWeHeartBeating{};
 			String currentMessage{};
@@ -266,7 +275,7 @@ namespace DiscordCoreAPI {
 			virtual ~WebSocketClient();
 
 		  protected:
-			UnorderedMap<uint64_t, UnboundedMessageBlock<VoiceConnectionData>*> voiceConnectionDataBufferMap{};
+			UnorderedMap<uint64_t, MPMCQueue<VoiceConnectionData>*> voiceConnectionDataBufferMap{};
 			VoiceConnectionData voiceConnectionData{};
 			DiscordCoreClient* discordCoreClient{};
 			std::atomic_bool* doWeQuit{};
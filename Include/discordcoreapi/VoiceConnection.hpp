@@ -247,6 +247,8 @@ namespace DiscordCoreAPI {
 		MovingAverager voiceUserCountAverage{ 25 };
 		DiscordCoreClient* discordCoreClient{};
 		Jsonifier::Vector<uint8_t> resampleVector{};
+		AudioFrameData outgoingFrame{};///< Reused for each outgoing frame - trySend() hands back the storage of the slot it filled.
+		uint64_t droppedFrameCount{};///< The number of outgoing frames that were dropped because the audio buffer was full.
 		opus_int16 downSampledVector[23040]{};
 		opus_int32 upSampledVector[23040]{};
 		Snowflake guildId{};
@@ -307,7 +309,7 @@ namespace DiscordCoreAPI {
 
 	  protected:
 		std::atomic<VoiceConnectionState> connectionState{ VoiceConnectionState::Collecting_Init_Data };
-		UnboundedMessageBlock<DiscordCoreInternal::VoiceConnectionData> voiceConnectionDataBuffer{};
+		MPMCQueue<DiscordCoreInternal::VoiceConnectionData> voiceConnectionDataBuffer{ 2 };
 		Nanoseconds intervalCount{ static_cast<int64_t>(960.0l / 48000.0l * 1000000000.0l) };
 		std::coroutine_handle<DiscordCoreAPI::CoRoutine<void, false>::promise_type> token{};
 		std::atomic<VoiceActiveState> prevActiveState{ VoiceActiveState::Stopped };
@@ -340,7 +342,7 @@ namespace DiscordCoreAPI {
 
 		void parseIncomingVoiceData(std::basic_string_view<uint8_t> rawDataBufferNew);
 
-		UnboundedMessageBlock<AudioFrameData>& getAudioBuffer();
+		BoundedMessageBlock<AudioFrameData>& getAudioBuffer();
 
 		void skipInternal(uint32_t currentRecursionDepth = 0);
 
@@ -56,10 +56,11 @@ namespace DiscordCoreAPI {
 		  public:
 			YouTubeAPI(ConfigManager* configManagerNew, const Snowflake guildId);
 
-			CoRoutine<void, false> downloadAndStreamAudio(const Song songNew,
+			CoRoutine<void, false> downloadAndStreamAudio(const Song songNew, BoundedMessageBlock<AudioFrameData>& audioDataBuffer,
 				NewThreadAwaiter<void, false> threadHandle = NewThreadAwaiter<void, false>{}, uint64_t currentReconnectTries = 0);
 
-			void weFailedToDownloadOrDecode(const Song& songNew, NewThreadAwaiter<void, false> threadHandle, uint64_t currentRetries);
+			void weFailedToDownloadOrDecode(const Song& songNew, BoundedMessageBlock<AudioFrameData>& audioDataBuffer,
+				NewThreadAwaiter<void, false> threadHandle, uint64_t currentRetries);
 
 			Song collectFinalSong(const Song& songNew) override;
 
@@ -67,8 +68,26 @@ namespace DiscordCoreAPI {
 
 			bool areWeWorking();
 
+			/// @brief Waits for every running download to finish.
+			/// @param deadline When to give up waiting.
+			/// @return Whether or not the downloads finished in time.
+			bool waitForIdle(HRClock::time_point deadline);
+
 		  protected:
-			std::atomic_bool areWeWorkingBool{ false };
+			/// @brief Counts a download as running for as long as it is in scope - so that a prefetch and the playing Song, downloading
+			/// side by side, each keep their own count.
+			struct WorkingScope {
+				WorkingScope(YouTubeAPI& apiNew);
+
+				~WorkingScope();
+
+			  protected:
+				YouTubeAPI& api;
+			};
+
+			std::condition_variable workingCondition{};
+			uint32_t workingCount{};
+			std::mutex workingMutex{};
 			Snowflake guildId{};
 		};
 
@@ -102,13 +102,13 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Global_Application_Commands };
 		co_await NewThreadAwaitable<Jsonifier::Vector<ApplicationCommandData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/applications/" + dataPackage.applicationId + "/commands";
+		workload.setRelativePath("/applications/", dataPackage.applicationId, "/commands");
 		if (dataPackage.withLocalizations) {
 			workload.relativePath += "?with_localizations=true";
 		}
 		workload.callStack = "ApplicationCommands::getGlobalApplicationCommandsAsync()";
 		Jsonifier::Vector<ApplicationCommandData> returnData{};
-		ApplicationCommands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await ApplicationCommands::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -116,11 +116,11 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Global_Application_Command };
 		co_await NewThreadAwaitable<ApplicationCommandData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/applications/" + dataPackage.applicationId + "/commands";
+		workload.setRelativePath("/applications/", dataPackage.applicationId, "/commands");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "ApplicationCommands::createGlobalApplicationCommandAsync()";
 		ApplicationCommandData returnData{};
-		ApplicationCommands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await ApplicationCommands::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -128,10 +128,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Global_Application_Command };
 		co_await NewThreadAwaitable<ApplicationCommandData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/applications/" + dataPackage.applicationId + "/commands/" + dataPackage.commandId;
+		workload.setRelativePath("/applications/", dataPackage.applicationId, "/commands/", dataPackage.commandId);
 		workload.callStack = "ApplicationCommands::getGlobalApplicationCommandAsync()";
 		ApplicationCommandData returnData{};
-		ApplicationCommands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await ApplicationCommands::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -151,11 +151,11 @@ namespace DiscordCoreAPI {
 			co_return ApplicationCommandData();
 		}
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/applications/" + dataPackage.applicationId + "/commands/" + appCommandId;
+		workload.setRelativePath("/applications/", dataPackage.applicationId, "/commands/", appCommandId);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "ApplicationCommands::editGlobalApplicationCommandAsync()";
 		ApplicationCommandData returnData{};
-		ApplicationCommands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await ApplicationCommands::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -175,9 +175,9 @@ namespace DiscordCoreAPI {
 			co_return;
 		}
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/applications/" + dataPackage.applicationId + "/commands/" + commandId;
+		workload.setRelativePath("/applications/", dataPackage.applicationId, "/commands/", commandId);
 		workload.callStack = "ApplicationCommands::deleteGlobalApplicationCommandAsync()";
-		ApplicationCommands::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await ApplicationCommands::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -186,11 +186,11 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Bulk_Put_Global_Application_Commands };
 		co_await NewThreadAwaitable<Jsonifier::Vector<ApplicationCommandData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Put;
-		workload.relativePath = "/applications/" + dataPackage.applicationId + "/commands";
+		workload.setRelativePath("/applications/", dataPackage.applicationId, "/commands");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "ApplicationCommands::bulkOverwriteGlobalApplicationCommandsAsync()";
 		Jsonifier::Vector<ApplicationCommandData> returnData{};
-		ApplicationCommands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await ApplicationCommands::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -199,13 +199,13 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Application_Commands };
 		co_await NewThreadAwaitable<Jsonifier::Vector<ApplicationCommandData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/applications/" + dataPackage.applicationId + "/guilds/" + dataPackage.guildId + "/commands";
+		workload.setRelativePath("/applications/", dataPackage.applicationId, "/guilds/", dataPackage.guildId, "/commands");
 		if (dataPackage.withLocalizations) {
 			workload.relativePath += "?with_localizations=true";
 		}
 		workload.callStack = "ApplicationCommands::getGuildApplicationCommandsAsync()";
 		Jsonifier::Vector<ApplicationCommandData> returnData{};
-		ApplicationCommands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await ApplicationCommands::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -214,11 +214,11 @@ namespace DiscordCoreAPI {
 		co_await NewThreadAwaitable<ApplicationCommandData>();
 		dataPackage.applicationId = dataPackage.applicationId;
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/applications/" + dataPackage.applicationId + "/guilds/" + dataPackage.guildId + "/commands";
+		workload.setRelativePath("/applications/", dataPackage.applicationId, "/guilds/", dataPackage.guildId, "/commands");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "ApplicationCommands::createGuildApplicationCommandAsync()";
 		ApplicationCommandData returnData{};
-		ApplicationCommands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await ApplicationCommands::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -226,11 +226,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Application_Command };
 		co_await NewThreadAwaitable<ApplicationCommandData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath =
-			"/applications/" + dataPackage.applicationId + "/guilds/" + dataPackage.guildId + "/commands/" + std::to_string(dataPackage.commandId);
+		workload.setRelativePath("/applications/", dataPackage.applicationId, "/guilds/", dataPackage.guildId, "/commands/", dataPackage.commandId);
 		workload.callStack = "ApplicationCommands::getGuildApplicationCommandAsync()";
 		ApplicationCommandData returnData{};
-		ApplicationCommands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await ApplicationCommands::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -250,11 +249,11 @@ namespace DiscordCoreAPI {
 			co_return ApplicationCommandData();
 		}
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/applications/" + dataPackage.applicationId + "/guilds/" + dataPackage.guildId + "/commands/" + appCommandId;
+		workload.setRelativePath("/applications/", dataPackage.applicationId, "/guilds/", dataPackage.guildId, "/commands/", appCommandId);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "ApplicationCommands::editGuildApplicationCommandAsync()";
 		ApplicationCommandData returnData{};
-		ApplicationCommands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await ApplicationCommands::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -274,9 +273,9 @@ namespace DiscordCoreAPI {
 			co_return;
 		}
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/applications/" + dataPackage.applicationId + "/guilds/" + dataPackage.guildId + "/commands/" + commandId;
+		workload.setRelativePath("/applications/", dataPackage.applicationId, "/guilds/", dataPackage.guildId, "/commands/", commandId);
 		workload.callStack = "ApplicationCommands::deleteGuildApplicationCommandAsync()";
-		ApplicationCommands::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await ApplicationCommands::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -286,10 +285,10 @@ namespace DiscordCoreAPI {
 		co_await NewThreadAwaitable<Jsonifier::Vector<ApplicationCommandData>>();
 		parser.serializeJson(dataPackage, workload.content);
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Put;
-		workload.relativePath = "/applications/" + dataPackage.applicationId + "/guilds/" + dataPackage.guildId + "/commands";
+		workload.setRelativePath("/applications/", dataPackage.applicationId, "/guilds/", dataPackage.guildId, "/commands");
 		workload.callStack = "ApplicationCommands::bulkOverwriteGuildApplicationCommandsAsync()";
 		Jsonifier::Vector<ApplicationCommandData> returnData{};
-		ApplicationCommands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await ApplicationCommands::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -298,10 +297,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Application_Commands_Permissions };
 		co_await NewThreadAwaitable<Jsonifier::Vector<GuildApplicationCommandPermissionsData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/applications/" + dataPackage.applicationId + "/guilds/" + dataPackage.guildId + "/commands/permissions";
+		workload.setRelativePath("/applications/", dataPackage.applicationId, "/guilds/", dataPackage.guildId, "/commands/permissions");
 		workload.callStack = "ApplicationCommands::getGuildApplicationCommandPermissionsAsync()";
 		Jsonifier::Vector<GuildApplicationCommandPermissionsData> returnData{};
-		ApplicationCommands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await ApplicationCommands::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -322,11 +321,11 @@ namespace DiscordCoreAPI {
 			co_return GuildApplicationCommandPermissionsData();
 		}
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath =
-			"/applications/" + dataPackage.applicationId + "/guilds/" + dataPackage.guildId + "/commands/" + commandId + "/permissions";
+		workload.setRelativePath("/applications/", dataPackage.applicationId, "/guilds/", dataPackage.guildId, "/commands/", commandId,
+			"/permissions");
 		workload.callStack = "ApplicationCommands::getApplicationCommandPermissionsAsync()";
 		GuildApplicationCommandPermissionsData returnData{};
-		ApplicationCommands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await ApplicationCommands::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -347,12 +346,12 @@ namespace DiscordCoreAPI {
 			co_return GuildApplicationCommandPermissionsData();
 		}
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Put;
-		workload.relativePath =
-			"/applications/" + dataPackage.applicationId + "/guilds/" + dataPackage.guildId + "/commands/" + commandId + "/permissions";
+		workload.setRelativePath("/applications/", dataPackage.applicationId, "/guilds/", dataPackage.guildId, "/commands/", commandId,
+			"/permissions");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "ApplicationCommands::editGuildApplicationCommandPermissionsAsync()";
 		GuildApplicationCommandPermissionsData returnData{};
-		ApplicationCommands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await ApplicationCommands::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -60,10 +60,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Auto_Moderation_Rules };
 		co_await NewThreadAwaitable<Jsonifier::Vector<AutoModerationRuleData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/auto-moderation/rules";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/auto-moderation/rules");
 		workload.callStack = "AutoModerationRules::listAutoModerationRulesForGuildAsync()";
 		Jsonifier::Vector<AutoModerationRuleData> returnVector{};
-		AutoModerationRules::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnVector);
+		co_await AutoModerationRules::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnVector);
 		co_return std::move(returnVector);
 	}
 
@@ -71,10 +71,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Auto_Moderation_Rule };
 		co_await NewThreadAwaitable<AutoModerationRuleData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/auto-moderation/rules/" + std::to_string(dataPackage.autoModerationRuleId);
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/auto-moderation/rules/", dataPackage.autoModerationRuleId);
 		workload.callStack = "AutoModerationRules::getAutoModerationRuleAsync()";
 		AutoModerationRuleData returnData{};
-		AutoModerationRules::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await AutoModerationRules::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -82,11 +82,11 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Auto_Moderation_Rule };
 		co_await NewThreadAwaitable<AutoModerationRuleData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/auto-moderation/rules";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/auto-moderation/rules");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "AutoModerationRules::createAutoModerationRuleAsync()";
 		AutoModerationRuleData returnData{};
-		AutoModerationRules::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await AutoModerationRules::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -94,11 +94,11 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Auto_Moderation_Rule };
 		co_await NewThreadAwaitable<AutoModerationRuleData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/auto-moderation/rules/" + std::to_string(dataPackage.autoModerationRuleId);
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/auto-moderation/rules/", dataPackage.autoModerationRuleId);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "AutoModerationRules::modifyAutoModerationRuleAsync()";
 		AutoModerationRuleData returnData{};
-		AutoModerationRules::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await AutoModerationRules::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -106,9 +106,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Auto_Moderation_Rule };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/auto-moderation/rules/" + std::to_string(dataPackage.autoModerationRuleId);
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/auto-moderation/rules/", dataPackage.autoModerationRuleId);
 		workload.callStack = "AutoModerationRules::deleteAutoModerationRuleAsync()";
-		AutoModerationRules::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await AutoModerationRules::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -226,13 +226,13 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Channel };
 		co_await NewThreadAwaitable<ChannelData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/channels/" + dataPackage.channelId;
+		workload.setRelativePath("/channels/", dataPackage.channelId);
 		workload.callStack = "Channels::getChannelAsync()";
 		ChannelData data{ dataPackage.channelId };
 		if (cache.contains(data.id)) {
 			data = cache[data.id];
 		}
-		Channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		co_await Channels::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), data);
 		if (doWeCacheChannelsBool) {
 			insertChannel(static_cast<ChannelCacheData>(data));
 		}
@@ -252,7 +252,7 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Channel };
 		co_await NewThreadAwaitable<ChannelData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/channels/" + dataPackage.channelId;
+		workload.setRelativePath("/channels/", dataPackage.channelId);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Channels::modifyChannelAsync()";
 		if (dataPackage.reason != "") {
@@ -262,7 +262,7 @@ namespace DiscordCoreAPI {
 		if (cache.contains(data.id)) {
 			data = cache[data.id];
 		}
-		Channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		co_await Channels::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), data);
 		if (doWeCacheChannelsBool) {
 			insertChannel(static_cast<ChannelCacheData>(data));
 		}
@@ -273,12 +273,12 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Channel };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/channels/" + dataPackage.channelId;
+		workload.setRelativePath("/channels/", dataPackage.channelId);
 		workload.callStack = "Channels::deleteOrCloseAChannelAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Channels::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Channels::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -286,13 +286,13 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Put_Channel_Permission_Overwrites };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Put;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/permissions/" + dataPackage.roleOrUserId;
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/permissions/", dataPackage.roleOrUserId);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Channels::editChannelPermissionOverwritesAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Channels::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Channels::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -300,10 +300,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Channel_Invites };
 		co_await NewThreadAwaitable<Jsonifier::Vector<InviteData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/invites";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/invites");
 		workload.callStack = "Channels::getChannelInvitesAsync()";
 		Jsonifier::Vector<InviteData> returnData{};
-		Channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Channels::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -311,14 +311,14 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Channel_Invite };
 		co_await NewThreadAwaitable<InviteData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/invites";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/invites");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Channels::createChannelInviteAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		InviteData returnData{};
-		Channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Channels::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -326,12 +326,12 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Channel_Permission_Overwrites };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/permissions/" + dataPackage.roleOrUserId;
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/permissions/", dataPackage.roleOrUserId);
 		workload.callStack = "Channels::deleteChannelPermissionOverwritesAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Channels::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Channels::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -339,11 +339,11 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Follow_News_Channel };
 		co_await NewThreadAwaitable<ChannelData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/followers";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/followers");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Channels::followNewsChannelAsync()";
 		ChannelData returnData{};
-		Channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Channels::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -351,9 +351,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Trigger_Typing_Indicator };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/typing";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/typing");
 		workload.callStack = "Channels::triggerTypingIndicatorAsync()";
-		Channels::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Channels::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -361,10 +361,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Channels };
 		co_await NewThreadAwaitable<Jsonifier::Vector<ChannelData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/channels";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/channels");
 		workload.callStack = "Channels::getGuildChannelsAsync()";
 		Jsonifier::Vector<ChannelData> returnData{};
-		Channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Channels::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -372,14 +372,14 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Guild_Channel };
 		co_await NewThreadAwaitable<ChannelData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/channels";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/channels");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Channels::createGuildChannelAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		ChannelData returnData{};
-		Channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Channels::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -387,13 +387,13 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Guild_Channel_Positions };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/channels";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/channels");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Channels::modifyGuildChannelPositionsAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Channels::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Channels::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -405,7 +405,7 @@ namespace DiscordCoreAPI {
 		workload.callStack = "Channels::createDMChannelAsync()";
 		parser.serializeJson(dataPackage, workload.content);
 		ChannelData returnData{};
-		Channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Channels::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -416,7 +416,7 @@ namespace DiscordCoreAPI {
 		workload.relativePath = "/voice/regions";
 		workload.callStack = "Channels::getVoiceRegionsAsync()";
 		Jsonifier::Vector<VoiceRegionData> returnData{};
-		Channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Channels::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -34,64 +34,134 @@
 namespace DiscordCoreAPI {
 
 	UnorderedMap<Jsonifier::Vector<std::string>, UniquePtr<BaseFunction>> functions{};
+	UnorderedMap<std::string, BaseFunction*> functionIndex{};
 
 	CommandController::CommandController(DiscordCoreClient* discordCoreClientNew) {
 		discordCoreClient = discordCoreClientNew;
 	}
 
 	void CommandController::registerFunction(const Jsonifier::Vector<std::string>& functionNames, UniquePtr<BaseFunction> baseFunction) {
+		BaseFunction* functionPtr{ baseFunction.get() };
 		functions[functionNames] = std::move(baseFunction);
+		for (auto& value: functionNames) {
+			functionIndex[convertToLowerCase(value)] = functionPtr;
+		}
 	}
 
 	UnorderedMap<Jsonifier::Vector<std::string>, UniquePtr<BaseFunction>>& CommandController::getFunctions() {
 		return functions;
 	};
 
+	ShardCommandExecutor::ShardCommandExecutor() {
+		thread = DiscordCoreInternal::ThreadWrapper([this](DiscordCoreInternal::StopToken stopToken) {
+			while (!stopToken.stopRequested()) {
+				std::function<void()> task{};
+				tasks.receive(task);
+				if (task) {
+					task();
+				}
+			}
+		});
+	}
+
+	void ShardCommandExecutor::submit(std::function<void()> task) {
+		tasks.send(std::move(task));
+	}
+
+	ShardCommandExecutor::~ShardCommandExecutor() {
+		thread.requestStop();
+		tasks.send(std::function<void()>{});
+	}
+
 	CoRoutine<void> CommandController::checkForAndRunCommand(CommandData commandData) {
-		co_await NewThreadAwaitable<void>();
-		BaseFunctionArguments theArgsNew{ commandData, discordCoreClient };
 		UniquePtr<BaseFunction> functionPointer{ getCommand(convertToLowerCase(commandData.getCommandName())) };
 		if (!functionPointer.get()) {
 			co_return;
 		}
-
-		functionPointer->execute(theArgsNew);
+		switch (functionPointer->executionPolicy) {
+			case CommandExecutionPolicy::Inline: {
+				std::shared_ptr<BaseFunction> function{ functionPointer.release() };
+				getShardExecutor(commandData).submit([=, this]() {
+					executeCommand(*function, commandData);
+				});
+				co_return;
+			}
+			case CommandExecutionPolicy::Dedicated: {
+				std::shared_ptr<BaseFunction> function{ functionPointer.release() };
+				runOnDedicatedThread([=, this]() {
+					executeCommand(*function, commandData);
+				});
+				co_return;
+			}
+			case CommandExecutionPolicy::Pooled: {
+				co_await NewThreadAwaitable<void>();
+				executeCommand(*functionPointer, commandData);
+				co_return;
+			}
+		}
 		co_return;
 	}
 
-	UniquePtr<BaseFunction> CommandController::getCommand(const std::string& commandName) {
-		std::string functionName{};
-		bool isItFound{};
-		if (commandName.size() > 0) {
-			for (auto const& [keyFirst, value]: functions) {
-				for (auto& key: keyFirst) {
-					if (key.find(convertToLowerCase(commandName)) != std::string::npos) {
-						isItFound = true;
-						functionName = convertToLowerCase(commandName.substr(0, key.length()));
-						break;
-					}
-				}
-				if (isItFound) {
-					break;
-				}
+	ShardCommandExecutor& CommandController::getShardExecutor(const CommandData& commandData) {
+		uint64_t shardId{ (commandData.eventData.interactionData->guildId.operator const uint64_t&() >> 22) %
+			std::max<uint64_t>(discordCoreClient->getConfigManager().getTotalShardCount(), 1) };
+		std::unique_lock lock{ shardExecutorMutex };
+		if (!shardExecutors.contains(shardId)) {
+			shardExecutors.emplace(shardId, makeUnique<ShardCommandExecutor>());
+		}
+		return *shardExecutors[shardId];
+	}
+
+	void CommandController::runOnDedicatedThread(std::function<void()> task) {
+		std::unique_lock lock{ dedicatedThreadMutex };
+		Jsonifier::Vector<uint64_t> finishedIds{};
+		for (auto& [key, value]: dedicatedThreads) {
+			if (value->isItDone.load()) {
+				finishedIds.emplace_back(key);
 			}
 		}
-		if (isItFound) {
-			UniquePtr<BaseFunction> newValue = createFunction(functionName);
-			return newValue;
+		for (auto& value: finishedIds) {
+			dedicatedThreads.erase(value);
+		}
+		UniquePtr<DedicatedThread> dedicatedThread{ makeUnique<DedicatedThread>() };
+		std::atomic_bool* isItDone{ &dedicatedThread->isItDone };
+		dedicatedThread->thread = DiscordCoreInternal::ThreadWrapper([task = std::move(task), isItDone](DiscordCoreInternal::StopToken) {
+			task();
+			isItDone->store(true);
+		});
+		dedicatedThreads.emplace(++currentDedicatedId, std::move(dedicatedThread));
+	}
+
+	void CommandController::executeCommand(BaseFunction& function, const CommandData& commandData) {
+		BaseFunctionArguments theArgsNew{ commandData, discordCoreClient };
+		try {
+			function.execute(theArgsNew);
+		} catch (const std::exception& error) {
+			MessagePrinter::printError<PrintMessageType::General>(error.what());
+		} catch (...) {
+			MessagePrinter::printError<PrintMessageType::General>(
+				"CommandController::checkForAndRunCommand() Error: " + function.commandName + " threw an unknown exception.");
+		}
+	}
+
+	UniquePtr<BaseFunction> CommandController::getCommand(const std::string& commandName) {
+		if (commandName.size() > 0) {
+			return createFunction(commandName);
 		}
 		return nullptr;
 	}
 
 	UniquePtr<BaseFunction> CommandController::createFunction(const std::string& functionName) {
-		for (auto& [key01, value01]: functions) {
-			for (auto& value02: key01) {
-				if (functionName == value02) {
-					return value01->create();
-				}
-			}
+		auto iterator = functionIndex.find(functionName);
+		if (iterator != functionIndex.end()) {
+			return iterator->second->create();
 		}
 		return nullptr;
 	}
 
+	CommandController::~CommandController() {
+		std::unique_lock lock{ dedicatedThreadMutex };
+		dedicatedThreads.clear();
+	}
+
 }
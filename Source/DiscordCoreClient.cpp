@@ -31,6 +31,8 @@
 #include <discordcoreapi/DiscordCoreClient.hpp>
 #include <discordcoreapi/CommandController.hpp>
 #include <csignal>
+#include <fstream>
+#include <sstream>
 #include <atomic>
 
 namespace DiscordCoreAPI {
@@ -134,6 +136,12 @@ namespace DiscordCoreAPI {
 			return;
 		}
 		httpsClient = makeUnique<DiscordCoreInternal::HttpsClient>(configManager.getBotToken());
+		for (auto& [key, value]: configManager.getResponseCacheTtls()) {
+			httpsClient->setResponseCacheTtl(key, Milliseconds{ value });
+		}
+		if (configManager.getAudioCacheDirectory() != "") {
+			audioCache = makeUnique<AudioCache>(configManager.getAudioCacheDirectory(), configManager.getAudioCacheSizeBudget());
+		}
 		ApplicationCommands::initialize(httpsClient.get());
 		AutoModerationRules::initialize(httpsClient.get());
 		Channels::initialize(httpsClient.get(), &configManager);
@@ -155,6 +163,21 @@ namespace DiscordCoreAPI {
 		return configManager;
 	}
 
+	AudioCache* DiscordCoreClient::getAudioCache() {
+		return audioCache.get();
+	}
+
+	RestLaneStats DiscordCoreClient::getRestLaneStats(RestLane lane) {
+		return httpsClient->getLaneStats(lane);
+	}
+
+	TlsHandshakeStats DiscordCoreClient::getTlsHandshakeStats() {
+		TlsHandshakeStats returnData{};
+		returnData.resumedHandshakeCount = DiscordCoreInternal::TlsSessionCache::getResumedHandshakeCount();
+		returnData.fullHandshakeCount = DiscordCoreInternal::TlsSessionCache::getFullHandshakeCount();
+		return returnData;
+	}
+
 	BotUser DiscordCoreClient::getBotUser() {
 		return DiscordCoreClient::currentUser;
 	}
@@ -193,9 +216,13 @@ namespace DiscordCoreAPI {
 	}
 
 	void DiscordCoreClient::registerFunctionsInternal() {
+		if (configManager.doWeBulkOverwriteCommands()) {
+			return overwriteFunctionsInternal();
+		}
 		Jsonifier::Vector<ApplicationCommandData> theCommands{
 			ApplicationCommands::getGlobalApplicationCommandsAsync({ .applicationId = getBotUser().id, .withLocalizations = false }).get()
 		};
+		UnorderedMap<uint64_t, Jsonifier::Vector<ApplicationCommandData>> guildCommandsMap{};
 		while (commandsToRegister.size() > 0) {
 			CreateApplicationCommandData data = commandsToRegister.front();
 			commandsToRegister.pop_front();
@@ -207,11 +234,11 @@ namespace DiscordCoreAPI {
 					ApplicationCommands::createGlobalApplicationCommandAsync(*static_cast<CreateGlobalApplicationCommandData*>(&data)).get();
 				}
 			} else {
-				Jsonifier::Vector<ApplicationCommandData> guildCommands{};
-				if (data.guildId != 0) {
-					guildCommands = ApplicationCommands::getGuildApplicationCommandsAsync(
+				uint64_t guildId{ data.guildId.operator const uint64_t&() };
+				if (guildId != 0 && !guildCommandsMap.contains(guildId)) {
+					guildCommandsMap[guildId] = ApplicationCommands::getGuildApplicationCommandsAsync(
 						{ .applicationId = getBotUser().id, .withLocalizations = false, .guildId = data.guildId })
-										.get();
+													.get();
 				}
 				bool doesItExist{};
 				for (auto& value: theCommands) {
@@ -220,10 +247,12 @@ namespace DiscordCoreAPI {
 						break;
 					}
 				}
-				for (auto& value: guildCommands) {
-					if (value == data) {
-						doesItExist = true;
-						break;
+				if (guildId != 0) {
+					for (auto& value: guildCommandsMap[guildId]) {
+						if (value == data) {
+							doesItExist = true;
+							break;
+						}
 					}
 				}
 				try {
@@ -242,6 +271,89 @@ namespace DiscordCoreAPI {
 		}
 	}
 
+	void DiscordCoreClient::overwriteFunctionsInternal() {
+		UnorderedMap<uint64_t, Jsonifier::Vector<CreateApplicationCommandData>> scopes{};
+		UnorderedMap<uint64_t, bool> alwaysRegisterScopes{};
+		while (commandsToRegister.size() > 0) {
+			CreateApplicationCommandData data = commandsToRegister.front();
+			commandsToRegister.pop_front();
+			data.applicationId = getBotUser().id;
+			uint64_t scopeId{ data.guildId.operator const uint64_t&() };
+			alwaysRegisterScopes[scopeId] = alwaysRegisterScopes[scopeId] || data.alwaysRegister;
+			scopes[scopeId].emplace_back(data);
+		}
+
+		UnorderedMap<uint64_t, uint64_t> appliedHashes{};
+		std::string stateFilePath{ configManager.getCommandStateFilePath() };
+		if (stateFilePath != "") {
+			std::istringstream stream{ loadFileContents(stateFilePath) };
+			uint64_t scopeId{};
+			uint64_t hash{};
+			while (stream >> scopeId >> hash) {
+				appliedHashes[scopeId] = hash;
+			}
+		}
+
+		for (auto& [key, value]: scopes) {
+			std::sort(value.begin(), value.end(), [](const CreateApplicationCommandData& lhs, const CreateApplicationCommandData& rhs) {
+				return lhs.name < rhs.name;
+			});
+			BulkOverwriteGlobalApplicationCommandsData globalData{};
+			BulkOverwriteGuildApplicationCommandsData guildData{};
+			std::string canonicalString{};
+			if (key != 0) {
+				guildData.applicationId = getBotUser().id;
+				guildData.guildId = key;
+				for (auto& valueNew: value) {
+					guildData.responseData.emplace_back(*static_cast<CreateGuildApplicationCommandData*>(&valueNew));
+				}
+				parser.serializeJson(guildData, canonicalString);
+			} else {
+				globalData.applicationId = getBotUser().id;
+				for (auto& valueNew: value) {
+					globalData.responseData.emplace_back(*static_cast<CreateGlobalApplicationCommandData*>(&valueNew));
+				}
+				parser.serializeJson(globalData, canonicalString);
+			}
+			uint64_t canonicalHash{ KeyHasher{}(canonicalString) };
+			if (!alwaysRegisterScopes[key] && appliedHashes.contains(key) && appliedHashes[key] == canonicalHash) {
+				continue;
+			}
+			try {
+				Jsonifier::Vector<ApplicationCommandData> registeredCommands{};
+				if (key != 0) {
+					registeredCommands = ApplicationCommands::getGuildApplicationCommandsAsync(
+						{ .applicationId = getBotUser().id, .withLocalizations = false, .guildId = guildData.guildId })
+											 .get();
+				} else {
+					registeredCommands =
+						ApplicationCommands::getGlobalApplicationCommandsAsync({ .applicationId = getBotUser().id, .withLocalizations = false }).get();
+				}
+				bool areTheyEqual{ !alwaysRegisterScopes[key] && registeredCommands.size() == value.size() };
+				for (uint64_t x = 0; x < value.size() && areTheyEqual; ++x) {
+					areTheyEqual = std::find(registeredCommands.begin(), registeredCommands.end(), value[x]) != registeredCommands.end();
+				}
+				if (!areTheyEqual) {
+					if (key != 0) {
+						ApplicationCommands::bulkOverwriteGuildApplicationCommandsAsync(guildData).get();
+					} else {
+						ApplicationCommands::bulkOverwriteGlobalApplicationCommandsAsync(globalData).get();
+					}
+				}
+				appliedHashes[key] = canonicalHash;
+			} catch (DCAException& error) {
+				MessagePrinter::printError<PrintMessageType::Https>(error.what());
+			}
+		}
+
+		if (stateFilePath != "") {
+			std::ofstream stream{ stateFilePath, std::ios::out | std::ios::trunc };
+			for (auto& [key, value]: appliedHashes) {
+				stream << key << " " << value << "\n";
+			}
+		}
+	}
+
 	GatewayBotData DiscordCoreClient::getGateWayBot() {
 		try {
 			DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Gateway_Bot };
@@ -185,9 +185,9 @@ namespace Jsonifier {
 
 namespace DiscordCoreAPI {
 
-	template<> UnorderedMap<std::string, UnboundedMessageBlock<MessageData>*> ObjectCollector<MessageData>::objectsBuffersMap;
+	template<> DiscordCoreInternal::CollectorRegistry<MessageData> ObjectCollector<MessageData>::collectorRegistry;
 
-	template<> UnorderedMap<std::string, UnboundedMessageBlock<ReactionData>*> ObjectCollector<ReactionData>::objectsBuffersMap;
+	template<> DiscordCoreInternal::CollectorRegistry<ReactionData> ObjectCollector<ReactionData>::collectorRegistry;
 
 	OnInputEventCreationData::OnInputEventCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
 		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
@@ -216,6 +216,16 @@ namespace DiscordCoreAPI {
 
 	OnChannelCreationData::OnChannelCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
 		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		updateCache(value);
+	}
+
+	void OnChannelCreationData::updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
+		EventData<ChannelData> eventData{};
+		parserNew.parseJson<true, true>(eventData, dataToParse);
+		updateCache(eventData.value);
+	}
+
+	void OnChannelCreationData::updateCache(ChannelData& value) {
 		if (Channels::doWeCacheChannels()) {
 			if (Guilds::getCache().contains(value.guildId)) {
 				Guilds::getCache()[value.guildId].channels.emplace(value.id);
@@ -227,6 +237,16 @@ namespace DiscordCoreAPI {
 	OnChannelUpdateData::OnChannelUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
 		parserNew.parseJson<true, true>(*static_cast<UpdatedEventData*>(this), dataToParse);
 		oldValue = Channels::getCachedChannel({ .channelId = value.id });
+		updateCache(value);
+	}
+
+	void OnChannelUpdateData::updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
+		EventData<ChannelData> eventData{};
+		parserNew.parseJson<true, true>(eventData, dataToParse);
+		updateCache(eventData.value);
+	}
+
+	void OnChannelUpdateData::updateCache(ChannelData& value) {
 		if (Channels::doWeCacheChannels()) {
 			Channels::insertChannel(static_cast<ChannelCacheData>(value));
 		}
@@ -234,6 +254,16 @@ namespace DiscordCoreAPI {
 
 	OnChannelDeletionData::OnChannelDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
 		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		updateCache(value);
+	}
+
+	void OnChannelDeletionData::updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
+		EventData<ChannelData> eventData{};
+		parserNew.parseJson<true, true>(eventData, dataToParse);
+		updateCache(eventData.value);
+	}
+
+	void OnChannelDeletionData::updateCache(ChannelData& value) {
 		if (Channels::doWeCacheChannels()) {
 			if (Guilds::getCache().contains(value.guildId)) {
 				if (Guilds::getCache().operator[](value.guildId).channels.contains(value.id)) {
@@ -274,6 +304,16 @@ namespace DiscordCoreAPI {
 
 	OnGuildCreationData::OnGuildCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse, DiscordCoreClient* client) {
 		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		updateCache(value, client);
+	}
+
+	void OnGuildCreationData::updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse, DiscordCoreClient* client) {
+		EventData<GuildData> eventData{};
+		parserNew.parseJson<true, true>(eventData, dataToParse);
+		updateCache(eventData.value, client);
+	}
+
+	void OnGuildCreationData::updateCache(GuildData& value, DiscordCoreClient* client) {
 		value.discordCoreClient = client;
 		if (GuildMembers::doWeCacheGuildMembers()) {
 			for (auto& valueNew: value.members) {
@@ -323,6 +363,16 @@ namespace DiscordCoreAPI {
 
 	OnGuildUpdateData::OnGuildUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse, DiscordCoreClient* clientNew) {
 		parserNew.parseJson<true, true>(*static_cast<UpdatedEventData*>(this), dataToParse);
+		updateCache(value, clientNew);
+	}
+
+	void OnGuildUpdateData::updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse, DiscordCoreClient* clientNew) {
+		EventData<GuildData> eventData{};
+		parserNew.parseJson<true, true>(eventData, dataToParse);
+		updateCache(eventData.value, clientNew);
+	}
+
+	void OnGuildUpdateData::updateCache(GuildData& value, DiscordCoreClient* clientNew) {
 		value.discordCoreClient = clientNew;
 		if (Guilds::doWeCacheGuilds()) {
 			Guilds::insertGuild(static_cast<GuildCacheData>(value));
@@ -331,6 +381,16 @@ namespace DiscordCoreAPI {
 
 	OnGuildDeletionData::OnGuildDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
 		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		updateCache(value);
+	}
+
+	void OnGuildDeletionData::updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
+		EventData<GuildData> eventData{};
+		parserNew.parseJson<true, true>(eventData, dataToParse);
+		updateCache(eventData.value);
+	}
+
+	void OnGuildDeletionData::updateCache(GuildData& value) {
 		for (auto& valueNew: value.members) {
 			GuildMembers::removeGuildMember(valueNew);
 		}
@@ -347,6 +407,16 @@ namespace DiscordCoreAPI {
 
 	OnGuildBanAddData::OnGuildBanAddData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
 		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		updateCache(value);
+	}
+
+	void OnGuildBanAddData::updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
+		EventData<GuildBanAddData> eventData{};
+		parserNew.parseJson<true, true>(eventData, dataToParse);
+		updateCache(eventData.value);
+	}
+
+	void OnGuildBanAddData::updateCache(GuildBanAddData& value) {
 		if (Guilds::getCache().contains(value.guildId)) {
 			if (Guilds::getCache().operator[](value.guildId).members.contains(value.user.id)) {
 				Guilds::getCache().operator[](value.guildId).members.erase(value.user.id);
@@ -361,6 +431,16 @@ namespace DiscordCoreAPI {
 
 	OnGuildEmojisUpdateData::OnGuildEmojisUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
 		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		updateCache(value);
+	}
+
+	void OnGuildEmojisUpdateData::updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
+		EventData<GuildEmojisUpdateEventData> eventData{};
+		parserNew.parseJson<true, true>(eventData, dataToParse);
+		updateCache(eventData.value);
+	}
+
+	void OnGuildEmojisUpdateData::updateCache(GuildEmojisUpdateEventData& value) {
 		if (Guilds::getCache().contains(value.guildId)) {
 			Guilds::getCache()[value.guildId].emoji.clear();
 			for (auto& valueNew: value.emojis) {
@@ -379,6 +459,16 @@ namespace DiscordCoreAPI {
 
 	OnGuildMemberAddData::OnGuildMemberAddData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
 		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		updateCache(value);
+	}
+
+	void OnGuildMemberAddData::updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
+		EventData<GuildMemberData> eventData{};
+		parserNew.parseJson<true, true>(eventData, dataToParse);
+		updateCache(eventData.value);
+	}
+
+	void OnGuildMemberAddData::updateCache(GuildMemberData& value) {
 		if (GuildMembers::doWeCacheGuildMembers()) {
 			GuildMembers::insertGuildMember(static_cast<GuildMemberCacheData>(value));
 			if (Guilds::getCache().contains(value.guildId)) {
@@ -389,7 +479,16 @@ namespace DiscordCoreAPI {
 
 	OnGuildMemberRemoveData::OnGuildMemberRemoveData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
 		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
-		GuildMemberData guildMember = GuildMembers::getCachedGuildMember({ .guildMemberId = value.user.id, .guildId = value.guildId });
+		updateCache(value);
+	}
+
+	void OnGuildMemberRemoveData::updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
+		EventData<GuildMemberRemoveData> eventData{};
+		parserNew.parseJson<true, true>(eventData, dataToParse);
+		updateCache(eventData.value);
+	}
+
+	void OnGuildMemberRemoveData::updateCache(GuildMemberRemoveData& value) {
 		if (GuildMembers::doWeCacheGuildMembers()) {
 			if (Guilds::getCache().contains(value.guildId)) {
 				if (Guilds::getCache().operator[](value.guildId).members.contains(value.user.id)) {
@@ -397,13 +496,23 @@ namespace DiscordCoreAPI {
 					--Guilds::getCache()[value.guildId].memberCount;
 				}
 			}
-			GuildMembers::removeGuildMember(guildMember);
+			GuildMembers::removeGuildMember(TwoIdKey{ value.guildId, value.user.id });
 		}
 	}
 
 	OnGuildMemberUpdateData::OnGuildMemberUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
 		parserNew.parseJson<true, true>(*static_cast<UpdatedEventData*>(this), dataToParse);
 		oldValue = GuildMembers::getCachedGuildMember({ .guildMemberId = value.user.id, .guildId = value.guildId });
+		updateCache(value);
+	}
+
+	void OnGuildMemberUpdateData::updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
+		EventData<GuildMemberData> eventData{};
+		parserNew.parseJson<true, true>(eventData, dataToParse);
+		updateCache(eventData.value);
+	}
+
+	void OnGuildMemberUpdateData::updateCache(GuildMemberData& value) {
 		if (GuildMembers::doWeCacheGuildMembers()) {
 			GuildMembers::insertGuildMember(static_cast<GuildMemberCacheData>(value));
 		}
@@ -415,6 +524,16 @@ namespace DiscordCoreAPI {
 
 	OnRoleCreationData::OnRoleCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
 		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		updateCache(value);
+	}
+
+	void OnRoleCreationData::updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
+		EventData<RoleCreationData> eventData{};
+		parserNew.parseJson<true, true>(eventData, dataToParse);
+		updateCache(eventData.value);
+	}
+
+	void OnRoleCreationData::updateCache(RoleCreationData& value) {
 		if (Roles::doWeCacheRoles()) {
 			if (Guilds::getCache().contains(value.guildId)) {
 				Roles::insertRole(static_cast<RoleCacheData>(value.role));
@@ -426,6 +545,16 @@ namespace DiscordCoreAPI {
 	OnRoleUpdateData::OnRoleUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
 		parserNew.parseJson<true, true>(*static_cast<UpdatedEventData*>(this), dataToParse);
 		oldValue = Roles::getCachedRole({ .guildId = value.guildId, .roleId = value.role.id });
+		updateCache(value);
+	}
+
+	void OnRoleUpdateData::updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
+		EventData<RoleUpdateData> eventData{};
+		parserNew.parseJson<true, true>(eventData, dataToParse);
+		updateCache(eventData.value);
+	}
+
+	void OnRoleUpdateData::updateCache(RoleUpdateData& value) {
 		if (Roles::doWeCacheRoles()) {
 			Roles::insertRole(static_cast<RoleCacheData>(value.role));
 		}
@@ -433,6 +562,16 @@ namespace DiscordCoreAPI {
 
 	OnRoleDeletionData::OnRoleDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
 		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
+		updateCache(value);
+	}
+
+	void OnRoleDeletionData::updateCache(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
+		EventData<RoleDeletionData> eventData{};
+		parserNew.parseJson<true, true>(eventData, dataToParse);
+		updateCache(eventData.value);
+	}
+
+	void OnRoleDeletionData::updateCache(RoleDeletionData& value) {
 		if (Roles::doWeCacheRoles()) {
 			if (Guilds::getCache().contains(value.guildId)) {
 				if (Guilds::getCache().operator[](value.guildId).channels.contains(value.role.id)) {
@@ -455,7 +594,7 @@ namespace DiscordCoreAPI {
 			sslShard->voiceConnectionData.endPoint = value.endpoint;
 			sslShard->voiceConnectionData.token = value.token;
 			if (sslShard->voiceConnectionDataBufferMap.contains(value.guildId.operator const uint64_t&())) {
-				sslShard->voiceConnectionDataBufferMap[value.guildId.operator const uint64_t&()]->send(sslShard->voiceConnectionData);
+				sslShard->voiceConnectionDataBufferMap[value.guildId.operator const uint64_t&()]->trySend(sslShard->voiceConnectionData);
 			}
 			sslShard->areWeCollectingData.store(false);
 			sslShard->serverUpdateCollected = false;
@@ -499,6 +638,7 @@ namespace DiscordCoreAPI {
 		DiscordCoreClient* discordCoreClient) {
 		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
 		UniquePtr<InputEventData> eventData{ makeUnique<InputEventData>(value) };
+		Snowflake userId{ value.member.user.id != 0 ? value.member.user.id : value.user.id };
 		switch (value.type) {
 			case InteractionType::Application_Command: {
 				eventData->responseType = InputEventResponseType::Unset;
@@ -515,10 +655,8 @@ namespace DiscordCoreAPI {
 					case ComponentType::Button: {
 						eventData->responseType = InputEventResponseType::Unset;
 						*eventData->interactionData = value;
-						if (ButtonCollector::buttonInteractionBuffersMap.contains(eventData->getChannelData().id + eventData->getMessageData().id)) {
-							ButtonCollector::buttonInteractionBuffersMap[eventData->getChannelData().id + eventData->getMessageData().id]->send(
-								value);
-						}
+						ButtonCollector::buttonCollectorRegistry.deliver(value, eventData->getChannelData().id, eventData->getMessageData().id,
+							userId);
 						ButtonCollector::buttonInteractionEventsMap.operator()(*eventData->interactionData);
 						break;
 					}
@@ -529,11 +667,8 @@ namespace DiscordCoreAPI {
 					case ComponentType::String_Select: {
 						eventData->responseType = InputEventResponseType::Unset;
 						*eventData->interactionData = value;
-						if (SelectMenuCollector::selectMenuInteractionBuffersMap.contains(
-								eventData->getChannelData().id + eventData->getMessageData().id)) {
-							SelectMenuCollector::selectMenuInteractionBuffersMap[eventData->getChannelData().id + eventData->getMessageData().id]
-								->send(value);
-						}
+						SelectMenuCollector::selectMenuCollectorRegistry.deliver(value, eventData->getChannelData().id,
+							eventData->getMessageData().id, userId);
 						SelectMenuCollector::selectMenuInteractionEventsMap.operator()(*eventData->interactionData);
 						break;
 					}
@@ -548,8 +683,8 @@ namespace DiscordCoreAPI {
 				*eventData->interactionData = value;
 				UniquePtr<OnInputEventCreationData> eventCreationData{ makeUnique<OnInputEventCreationData>(parser, dataToParse) };
 				eventCreationData->value = *eventData;
-				if (ModalCollector::modalInteractionBuffersMap.contains(eventData->getChannelData().id)) {
-					ModalCollector::modalInteractionBuffersMap[eventData->getChannelData().id]->send(eventData->getInteractionData());
+				if (ModalCollector::modalCollectorRegistry.deliver(eventData->getInteractionData(), eventData->getChannelData().id,
+						eventData->getMessageData().id, userId)) {
 					ModalCollector::modalInteractionEventsMap.operator()(*eventData->interactionData);
 				}
 				break;
@@ -578,16 +713,12 @@ namespace DiscordCoreAPI {
 
 	OnMessageCreationData::OnMessageCreationData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
 		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
-		for (auto& [key, valueNew]: MessageCollector::objectsBuffersMap) {
-			valueNew->send(value);
-		}
+		MessageCollector::collectorRegistry.deliver(value, value.channelId, value.id, value.author.id);
 	}
 
 	OnMessageUpdateData::OnMessageUpdateData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
 		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
-		for (auto& [key, valueNew]: MessageCollector::objectsBuffersMap) {
-			valueNew->send(value);
-		}
+		MessageCollector::collectorRegistry.deliver(value, value.channelId, value.id, value.author.id);
 	}
 
 	OnMessageDeletionData::OnMessageDeletionData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
@@ -600,9 +731,7 @@ namespace DiscordCoreAPI {
 
 	OnReactionAddData::OnReactionAddData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
 		parserNew.parseJson<true, true>(*static_cast<EventData*>(this), dataToParse);
-		for (auto& [key, valueNew]: ReactionCollector::objectsBuffersMap) {
-			valueNew->send(value);
-		}
+		ReactionCollector::collectorRegistry.deliver(value, value.channelId, value.messageId, value.userId);
 	}
 
 	OnReactionRemoveData::OnReactionRemoveData(Jsonifier::JsonifierCore& parserNew, std::string_view dataToParse) {
@@ -656,7 +785,7 @@ namespace DiscordCoreAPI {
 		} else if (sslShard->areWeCollectingData.load() && !sslShard->stateUpdateCollected && value.userId == sslShard->userId) {
 			sslShard->voiceConnectionData.sessionId = value.sessionId;
 			if (sslShard->voiceConnectionDataBufferMap.contains(value.guildId.operator const uint64_t&())) {
-				sslShard->voiceConnectionDataBufferMap[value.guildId.operator const uint64_t&()]->send(std::move(sslShard->voiceConnectionData));
+				sslShard->voiceConnectionDataBufferMap[value.guildId.operator const uint64_t&()]->trySend(std::move(sslShard->voiceConnectionData));
 			}
 			sslShard->areWeCollectingData.store(false);
 			sslShard->serverUpdateCollected = false;
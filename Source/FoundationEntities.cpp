@@ -74,9 +74,11 @@ namespace DiscordCoreAPI {
 		HttpsWorkloadData& HttpsWorkloadData::operator=(HttpsWorkloadData&& other) noexcept {
 			if (this != &other) {
 				headersToInsert = std::move(other.headersToInsert);
+				headersToCollect = std::move(other.headersToCollect);
 				relativePath = std::move(other.relativePath);
 				thisWorkerId.store(thisWorkerId.load());
 				callStack = std::move(other.callStack);
+				acceptCompressed = other.acceptCompressed;
 				workloadClass = other.workloadClass;
 				baseUrl = std::move(other.baseUrl);
 				content = std::move(other.content);
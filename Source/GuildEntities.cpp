@@ -301,37 +301,38 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Audit_Logs };
 		co_await NewThreadAwaitable<AuditLogData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/audit-logs";
+		workload.acceptCompressed = true;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/audit-logs");
 		if (dataPackage.userId != 0) {
-			workload.relativePath += "?user_id=" + dataPackage.userId;
+			workload.appendToRelativePath("?user_id=", dataPackage.userId);
 			if (std::to_string(static_cast<uint64_t>(dataPackage.actionType)) != "") {
-				workload.relativePath += "&action_type=" + std::to_string(static_cast<uint64_t>(dataPackage.actionType));
+				workload.appendToRelativePath("&action_type=", static_cast<uint64_t>(dataPackage.actionType));
 			}
 			if (dataPackage.limit != 0) {
-				workload.relativePath += "&limit=" + std::to_string(dataPackage.limit);
+				workload.appendToRelativePath("&limit=", dataPackage.limit);
 			}
 			if (dataPackage.before != 0) {
-				workload.relativePath += "&before=" + dataPackage.before;
+				workload.appendToRelativePath("&before=", dataPackage.before);
 			}
 		} else if (std::to_string(static_cast<uint64_t>(dataPackage.actionType)) != "") {
-			workload.relativePath += "?action_type=" + std::to_string(static_cast<uint64_t>(dataPackage.actionType));
+			workload.appendToRelativePath("?action_type=", static_cast<uint64_t>(dataPackage.actionType));
 			if (dataPackage.limit != 0) {
-				workload.relativePath += "&limit=" + std::to_string(dataPackage.limit);
+				workload.appendToRelativePath("&limit=", dataPackage.limit);
 			}
 			if (dataPackage.before != 0) {
-				workload.relativePath += "&before=" + dataPackage.before;
+				workload.appendToRelativePath("&before=", dataPackage.before);
 			}
 		} else if (dataPackage.limit != 0) {
-			workload.relativePath += "?limit=" + std::to_string(dataPackage.limit);
+			workload.appendToRelativePath("?limit=", dataPackage.limit);
 			if (dataPackage.before != 0) {
-				workload.relativePath += "&before=" + dataPackage.before;
+				workload.appendToRelativePath("&before=", dataPackage.before);
 			}
 		} else if (dataPackage.before != 0) {
-			workload.relativePath += "?before=" + dataPackage.before;
+			workload.appendToRelativePath("?before=", dataPackage.before);
 		}
 		workload.callStack = "Guilds::getAuditLogDataAsync()";
 		AuditLogData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -343,7 +344,7 @@ namespace DiscordCoreAPI {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Guilds::createGuildAsync()";
 		GuildData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		returnData.discordCoreClient = Guilds::discordCoreClient;
 		co_return returnData;
 	}
@@ -361,14 +362,14 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild };
 		co_await NewThreadAwaitable<GuildData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "?with_counts=true";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "?with_counts=true");
 		workload.callStack = "Guilds::getGuildAsync()";
 		GuildData data{ dataPackage.guildId };
 		data.discordCoreClient = Guilds::discordCoreClient;
 		if (cache.contains(data.id)) {
 			data = cache[data.id];
 		}
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), data);
 		if (doWeCacheGuildsBool) {
 			insertGuild(static_cast<GuildCacheData>(data));
 		}
@@ -391,10 +392,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Preview };
 		co_await NewThreadAwaitable<GuildPreviewData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/preview";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/preview");
 		workload.callStack = "Guilds::getGuildPreviewAsync()";
 		GuildPreviewData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -402,7 +403,7 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Guild };
 		co_await NewThreadAwaitable<GuildData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/guilds/" + dataPackage.guildId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Guilds::modifyGuildAsync()";
 		if (dataPackage.reason != "") {
@@ -413,7 +414,7 @@ namespace DiscordCoreAPI {
 		if (cache.contains(data.id)) {
 			data = cache[data.id];
 		}
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), data);
 		if (doWeCacheGuildsBool) {
 			insertGuild(static_cast<GuildCacheData>(data));
 		}
@@ -424,9 +425,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Guild };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/guilds/" + dataPackage.guildId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId);
 		workload.callStack = "Guilds::deleteGuildAsync()";
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -434,26 +435,26 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Bans };
 		co_await NewThreadAwaitable<Jsonifier::Vector<BanData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/bans";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/bans");
 		if (dataPackage.after != 0) {
-			workload.relativePath += "?after=" + dataPackage.after;
+			workload.appendToRelativePath("?after=", dataPackage.after);
 			if (dataPackage.before != 0) {
-				workload.relativePath += "&before=" + dataPackage.before;
+				workload.appendToRelativePath("&before=", dataPackage.before);
 			}
 			if (dataPackage.limit != 0) {
-				workload.relativePath += "&limit=" + std::to_string(dataPackage.limit);
+				workload.appendToRelativePath("&limit=", dataPackage.limit);
 			}
 		} else if (dataPackage.before != 0) {
-			workload.relativePath += "?before=" + dataPackage.before;
+			workload.appendToRelativePath("?before=", dataPackage.before);
 			if (dataPackage.limit != 0) {
-				workload.relativePath += "&limit=" + std::to_string(dataPackage.limit);
+				workload.appendToRelativePath("&limit=", dataPackage.limit);
 			}
 		} else if (dataPackage.limit != 0) {
-			workload.relativePath += "?limit=" + std::to_string(dataPackage.limit);
+			workload.appendToRelativePath("?limit=", dataPackage.limit);
 		}
 		workload.callStack = "Guilds::getGuildBansAsync()";
 		Jsonifier::Vector<BanData> returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -461,10 +462,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Ban };
 		co_await NewThreadAwaitable<BanData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/bans/" + dataPackage.userId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/bans/", dataPackage.userId);
 		workload.callStack = "Guilds::getGuildBanAsync()";
 		BanData data{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), data);
 		co_return std::move(data);
 	}
 
@@ -472,13 +473,13 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Put_Guild_Ban };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Put;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/bans/" + dataPackage.guildMemberId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/bans/", dataPackage.guildMemberId);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Guilds::createGuildBanAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -486,12 +487,12 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Guild_Ban };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/bans/" + dataPackage.userId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/bans/", dataPackage.userId);
 		workload.callStack = "Guilds::removeGuildBanAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -499,10 +500,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Prune_Count };
 		co_await NewThreadAwaitable<GuildPruneCountData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/prune";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/prune");
 		workload.callStack = "Guilds::getGuildPruneCountAsync()";
 		if (dataPackage.days != 0) {
-			workload.relativePath += "?days=" + std::to_string(dataPackage.days);
+			workload.appendToRelativePath("?days=", dataPackage.days);
 			if (dataPackage.includeRoles.size() > 0) {
 				workload.relativePath += "&include_roles=";
 				for (uint64_t x = 0; x < dataPackage.includeRoles.size(); ++x) {
@@ -522,7 +523,7 @@ namespace DiscordCoreAPI {
 			}
 		}
 		GuildPruneCountData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -530,14 +531,14 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Guild_Prune };
 		co_await NewThreadAwaitable<GuildPruneCountData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/prune";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/prune");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Guilds::beginGuildPruneAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		GuildPruneCountData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -545,10 +546,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Voice_Regions };
 		co_await NewThreadAwaitable<Jsonifier::Vector<VoiceRegionData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/regions";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/regions");
 		workload.callStack = "Guilds::getGuildVoiceRegionsAsync()";
 		Jsonifier::Vector<VoiceRegionData> returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -556,10 +557,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Invites };
 		co_await NewThreadAwaitable<Jsonifier::Vector<InviteData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/invites";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/invites");
 		workload.callStack = "Guilds::getGuildInvitesAsync()";
 		Jsonifier::Vector<InviteData> returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -567,10 +568,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Integrations };
 		co_await NewThreadAwaitable<Jsonifier::Vector<IntegrationData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/integrations";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/integrations");
 		workload.callStack = "Guilds::getGuildIntegrationsAsync()";
 		Jsonifier::Vector<IntegrationData> returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -578,12 +579,12 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Guild_Integration };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/integrations/" + dataPackage.integrationId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/integrations/", dataPackage.integrationId);
 		workload.callStack = "Guilds::deleteGuildIntegrationAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -591,10 +592,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Widget_Settings };
 		co_await NewThreadAwaitable<GuildWidgetData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/widget";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/widget");
 		workload.callStack = "Guilds::getGuildWidgetSettingsAsync()";
 		GuildWidgetData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -602,14 +603,14 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Guild_Widget };
 		co_await NewThreadAwaitable<GuildWidgetData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/widget";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/widget");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Guilds::modifyGuildWidgetAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		GuildWidgetData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -617,10 +618,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Widget };
 		co_await NewThreadAwaitable<GuildWidgetData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/widget.json";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/widget.json");
 		workload.callStack = "Guilds::getGuildWidgetAsync()";
 		GuildWidgetData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -628,10 +629,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Vanity_Invite };
 		co_await NewThreadAwaitable<InviteData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/vanity-url";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/vanity-url");
 		workload.callStack = "Guilds::getGuildVanityInviteAsync()";
 		InviteData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -639,7 +640,7 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Widget_Image };
 		co_await NewThreadAwaitable<GuildWidgetImageData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/widget.png";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/widget.png");
 		switch (dataPackage.widgetStlye) {
 			case WidgetStyleOptions::Shield: {
 				workload.relativePath += "?style=shield";
@@ -664,7 +665,7 @@ namespace DiscordCoreAPI {
 		}
 		workload.callStack = "Guilds::getGuildWidgetImageAsync()";
 		GuildWidgetImageData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -672,10 +673,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Welcome_Screen };
 		co_await NewThreadAwaitable<WelcomeScreenData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/welcome-screen";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/welcome-screen");
 		workload.callStack = "Guilds::getGuildWelcomeScreenAsync()";
 		WelcomeScreenData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -683,14 +684,14 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Guild_Welcome_Screen };
 		co_await NewThreadAwaitable<WelcomeScreenData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/welcome-screen";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/welcome-screen");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Guilds::modifyGuildWelcomeScreenAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		WelcomeScreenData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	};
 
@@ -698,10 +699,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Template };
 		co_await NewThreadAwaitable<GuildTemplateData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/templates/" + dataPackage.templateCode;
+		workload.setRelativePath("/guilds/templates/", dataPackage.templateCode);
 		workload.callStack = "Guilds::getGuildTemplateAsync()";
 		GuildTemplateData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -709,11 +710,11 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Guild_From_Guild_Template };
 		co_await NewThreadAwaitable<GuildData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/guilds/templates/" + dataPackage.templateCode;
+		workload.setRelativePath("/guilds/templates/", dataPackage.templateCode);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Guilds::createGuildFromGuildTemplateAsync()";
 		GuildData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		returnData.discordCoreClient = Guilds::discordCoreClient;
 		co_return returnData;
 	}
@@ -722,10 +723,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Templates };
 		co_await NewThreadAwaitable<Jsonifier::Vector<GuildTemplateData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/templates";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/templates");
 		workload.callStack = "Guilds::getGuildTemplatesAsync()";
 		Jsonifier::Vector<GuildTemplateData> returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -733,11 +734,11 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Guild_Template };
 		co_await NewThreadAwaitable<GuildTemplateData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/templates";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/templates");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Guilds::createGuildTemplateAsync()";
 		GuildTemplateData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -745,10 +746,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Put_Guild_Template };
 		co_await NewThreadAwaitable<GuildTemplateData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Put;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/templates/" + dataPackage.templateCode;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/templates/", dataPackage.templateCode);
 		workload.callStack = "Guilds::syncGuildTemplateAsync()";
 		GuildTemplateData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -756,11 +757,11 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Guild_Template };
 		co_await NewThreadAwaitable<GuildTemplateData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/templates/" + dataPackage.templateCode;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/templates/", dataPackage.templateCode);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Guilds::modifyGuildTemplateAsync()";
 		GuildTemplateData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -768,9 +769,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Guild_Template };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/templates/" + dataPackage.templateCode;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/templates/", dataPackage.templateCode);
 		workload.callStack = "Guilds::deleteGuildTemplateAsync()";
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -778,27 +779,27 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Invite };
 		co_await NewThreadAwaitable<InviteData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/invites/" + dataPackage.inviteId;
+		workload.setRelativePath("/invites/", dataPackage.inviteId);
 		if (dataPackage.withCount) {
 			workload.relativePath += "?with_counts=true";
 			if (dataPackage.withExpiration) {
 				workload.relativePath += "&with_expiration=true";
 			}
 			if (dataPackage.guildScheduledEventId != 0) {
-				workload.relativePath += "&guild_scheduled_event_id=" + dataPackage.guildScheduledEventId;
+				workload.appendToRelativePath("&guild_scheduled_event_id=", dataPackage.guildScheduledEventId);
 			}
 		} else if (dataPackage.withExpiration) {
 			workload.relativePath += "?with_expiration=true";
 			if (dataPackage.guildScheduledEventId != 0) {
-				workload.relativePath += "&guild_scheduled_event_id=" + dataPackage.guildScheduledEventId;
+				workload.appendToRelativePath("&guild_scheduled_event_id=", dataPackage.guildScheduledEventId);
 			}
 		} else if (dataPackage.guildScheduledEventId != 0) {
-			workload.relativePath += "?guild_scheduled_event_id=" + dataPackage.guildScheduledEventId;
+			workload.appendToRelativePath("?guild_scheduled_event_id=", dataPackage.guildScheduledEventId);
 		}
 
 		workload.callStack = "Guilds::getInviteAsync()";
 		InviteData returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -806,12 +807,12 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Invite };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/invites/" + dataPackage.inviteId;
+		workload.setRelativePath("/invites/", dataPackage.inviteId);
 		workload.callStack = "Guilds::deleteInviteAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -821,24 +822,24 @@ namespace DiscordCoreAPI {
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
 		workload.relativePath = "/users/@me/guilds";
 		if (dataPackage.after != 0) {
-			workload.relativePath += "?after=" + dataPackage.after;
+			workload.appendToRelativePath("?after=", dataPackage.after);
 			if (dataPackage.before != 0) {
-				workload.relativePath += "&before=" + dataPackage.before;
+				workload.appendToRelativePath("&before=", dataPackage.before);
 			}
 			if (dataPackage.limit != 0) {
-				workload.relativePath += "&limit=" + std::to_string(dataPackage.limit);
+				workload.appendToRelativePath("&limit=", dataPackage.limit);
 			}
 		} else if (dataPackage.before != 0) {
-			workload.relativePath += "?before=" + dataPackage.before;
+			workload.appendToRelativePath("?before=", dataPackage.before);
 			if (dataPackage.limit != 0) {
-				workload.relativePath += "&limit=" + std::to_string(dataPackage.limit);
+				workload.appendToRelativePath("&limit=", dataPackage.limit);
 			}
 		} else if (dataPackage.limit != 0) {
-			workload.relativePath += "?limit=" + std::to_string(dataPackage.limit);
+			workload.appendToRelativePath("?limit=", dataPackage.limit);
 		}
 		workload.callStack = "Users::getCurrentUserGuildsAsync()";
 		Jsonifier::Vector<GuildData> returnData{};
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		for (auto& value: returnData) {
 			value.discordCoreClient = Guilds::discordCoreClient;
 		}
@@ -849,9 +850,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Leave_Guild };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/users/@me/guilds/" + dataPackage.guildId;
+		workload.setRelativePath("/users/@me/guilds/", dataPackage.guildId);
 		workload.callStack = "Guilds::leaveGuildAsync()";
-		Guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Guilds::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -151,7 +151,7 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Member };
 		co_await NewThreadAwaitable<GuildMemberData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/members/" + dataPackage.guildMemberId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/members/", dataPackage.guildMemberId);
 		workload.callStack = "GuildMembers::getGuildMemberAsync()";
 		GuildMemberData data{};
 		data.user.id = dataPackage.guildMemberId;
@@ -160,7 +160,7 @@ namespace DiscordCoreAPI {
 		if (cache.contains(key)) {
 			data = cache[key];
 		}
-		GuildMembers::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		co_await GuildMembers::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), data);
 		if (doWeCacheGuildMembersBool) {
 			insertGuildMember(static_cast<GuildMemberCacheData>(data));
 		}
@@ -183,18 +183,19 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Members };
 		co_await NewThreadAwaitable<Jsonifier::Vector<GuildMemberData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/members";
+		workload.acceptCompressed = true;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/members");
 		if (dataPackage.after != 0) {
-			workload.relativePath += "?after=" + dataPackage.after;
+			workload.appendToRelativePath("?after=", dataPackage.after);
 			if (dataPackage.limit != 0) {
-				workload.relativePath += "&limit=" + std::to_string(dataPackage.limit);
+				workload.appendToRelativePath("&limit=", dataPackage.limit);
 			}
 		} else if (dataPackage.limit != 0) {
-			workload.relativePath += "?limit=" + std::to_string(dataPackage.limit);
+			workload.appendToRelativePath("?limit=", dataPackage.limit);
 		}
 		workload.callStack = "GuildMembers::listGuildMembersAsync()";
 		Jsonifier::Vector<GuildMemberData> returnData{};
-		GuildMembers::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await GuildMembers::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -202,18 +203,18 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Search_Guild_Members };
 		co_await NewThreadAwaitable<Jsonifier::Vector<GuildMemberData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/members/search";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/members/search");
 		if (dataPackage.query != "") {
-			workload.relativePath += "?query=" + dataPackage.query;
+			workload.appendToRelativePath("?query=", dataPackage.query);
 			if (dataPackage.limit != 0) {
-				workload.relativePath += "&limit=" + std::to_string(dataPackage.limit);
+				workload.appendToRelativePath("&limit=", dataPackage.limit);
 			}
 		} else if (dataPackage.limit != 0) {
-			workload.relativePath += "?limit=" + std::to_string(dataPackage.limit);
+			workload.appendToRelativePath("?limit=", dataPackage.limit);
 		}
 		workload.callStack = "GuildMembers::searchGuildMembersAsync()";
 		Jsonifier::Vector<GuildMemberData> returnData{};
-		GuildMembers::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await GuildMembers::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -221,11 +222,11 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Put_Guild_Member };
 		co_await NewThreadAwaitable<GuildMemberData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Put;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/members/" + dataPackage.userId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/members/", dataPackage.userId);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "GuildMembers::addGuildMemberAsync()";
 		GuildMemberData returnData{};
-		GuildMembers::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await GuildMembers::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -233,14 +234,14 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Current_Guild_Member };
 		co_await NewThreadAwaitable<GuildMemberData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/members/@me";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/members/@me");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "GuildMembers::modifyCurrentGuildMemberAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		GuildMemberData returnData{};
-		GuildMembers::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await GuildMembers::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -248,7 +249,7 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Guild_Member };
 		co_await NewThreadAwaitable<GuildMemberData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/members/" + dataPackage.guildMemberId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/members/", dataPackage.guildMemberId);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "GuildMembers::modifyGuildMemberAsync()";
 		if (dataPackage.reason != "") {
@@ -261,7 +262,7 @@ namespace DiscordCoreAPI {
 		if (cache.contains(key)) {
 			data = cache[key];
 		}
-		GuildMembers::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		co_await GuildMembers::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), data);
 		if (doWeCacheGuildMembersBool) {
 			insertGuildMember(static_cast<GuildMemberCacheData>(data));
 		}
@@ -272,12 +273,12 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Guild_Member };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/members/" + dataPackage.guildMemberId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/members/", dataPackage.guildMemberId);
 		workload.callStack = "GuildMembers::removeGuildMemberAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		GuildMembers::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await GuildMembers::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -62,10 +62,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Scheduled_Events };
 		co_await NewThreadAwaitable<Jsonifier::Vector<GuildScheduledEventData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/scheduled-events";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/scheduled-events");
 		workload.callStack = "GuildScheduledEvents::getGuildScheduledEventAsync()";
 		Jsonifier::Vector<GuildScheduledEventData> returnData{};
-		GuildScheduledEvents::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await GuildScheduledEvents::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -73,11 +73,11 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Guild_Scheduled_Event };
 		co_await NewThreadAwaitable<GuildScheduledEventData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/scheduled-events";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/scheduled-events");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "GuildScheduledEvents::createGuildScheduledEventAsync()";
 		GuildScheduledEventData returnData{};
-		GuildScheduledEvents::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await GuildScheduledEvents::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -85,14 +85,14 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Scheduled_Event };
 		co_await NewThreadAwaitable<GuildScheduledEventData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/scheduled-events/" + dataPackage.guildScheduledEventId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/scheduled-events/", dataPackage.guildScheduledEventId);
 		workload.relativePath += "?with_user_count=";
 		std::stringstream stream{};
 		stream << std::boolalpha << dataPackage.withUserCount;
 		workload.relativePath += stream.str();
 		workload.callStack = "GuildScheduledEvents::getGuildScheduledEventAsync()";
 		GuildScheduledEventData returnData{};
-		GuildScheduledEvents::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await GuildScheduledEvents::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -100,11 +100,11 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Guild_Scheduled_Event };
 		co_await NewThreadAwaitable<GuildScheduledEventData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/scheduled-events/" + dataPackage.guildScheduledEventId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/scheduled-events/", dataPackage.guildScheduledEventId);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "GuildScheduledEvents::modifyGuildScheduledEventAsync()";
 		GuildScheduledEventData returnData{};
-		GuildScheduledEvents::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await GuildScheduledEvents::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -112,9 +112,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Guild_Scheduled_Event };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/scheduled-events/" + dataPackage.guildScheduledEventId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/scheduled-events/", dataPackage.guildScheduledEventId);
 		workload.callStack = "GuildScheduledEvents::deleteGuildScheduledEventAsync()";
-		GuildScheduledEvents::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await GuildScheduledEvents::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -123,30 +123,30 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Scheduled_Event_Users };
 		co_await NewThreadAwaitable<Jsonifier::Vector<GuildScheduledEventUserData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/scheduled-events/" + dataPackage.guildScheduledEventId + "/users";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/scheduled-events/", dataPackage.guildScheduledEventId, "/users");
 		if (dataPackage.limit != 0) {
-			workload.relativePath += "?limit=" + std::to_string(dataPackage.limit);
+			workload.appendToRelativePath("?limit=", dataPackage.limit);
 			if (dataPackage.after != 0) {
-				workload.relativePath += "&after=" + dataPackage.after;
+				workload.appendToRelativePath("&after=", dataPackage.after);
 			}
 			if (dataPackage.before != 0) {
-				workload.relativePath += "&before=" + dataPackage.before;
+				workload.appendToRelativePath("&before=", dataPackage.before);
 			}
 			if (dataPackage.withMember) {
 				workload.relativePath += "&with_member=true";
 			}
 		}
 		if (dataPackage.after != 0) {
-			workload.relativePath += "?after=" + dataPackage.after;
+			workload.appendToRelativePath("?after=", dataPackage.after);
 			if (dataPackage.before != 0) {
-				workload.relativePath += "&before=" + dataPackage.before;
+				workload.appendToRelativePath("&before=", dataPackage.before);
 			}
 			if (dataPackage.withMember) {
 				workload.relativePath += "&with_member=true";
 			}
 		}
 		if (dataPackage.before != 0) {
-			workload.relativePath += "?before=" + dataPackage.before;
+			workload.appendToRelativePath("?before=", dataPackage.before);
 			if (dataPackage.withMember) {
 				workload.relativePath += "&with_member=true";
 			}
@@ -156,7 +156,7 @@ namespace DiscordCoreAPI {
 		}
 		workload.callStack = "GuildScheduledEvents::getGuildScheduledEventUsersAsync()";
 		Jsonifier::Vector<GuildScheduledEventUserData> returnData{};
-		GuildScheduledEvents::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await GuildScheduledEvents::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -31,6 +31,8 @@
 #include <discordcoreapi/Utilities/HttpsClient.hpp>
 #include <discordcoreapi/CoRoutine.hpp>
 #include <discordcoreapi/DiscordCoreClient.hpp>
+#include <zlib.h>
+#include <charconv>
 
 namespace DiscordCoreAPI {
 
@@ -41,16 +43,120 @@ namespace DiscordCoreAPI {
 			ptr = ptrNew;
 		};
 
-		Jsonifier::Vector<std::string> tokenize(std::string const& in, const char* sep = "\r\n") {
-			std::string::size_type b = 0;
-			Jsonifier::Vector<std::string> result;
+		HttpsTCPConnection::HttpsTCPConnection(HttpsConnection* ptrNew) {
+			ptr = ptrNew;
+		};
+
+		/// @brief Compares a header name against a lower-case literal without copying or lower-casing the name.
+		inline bool headerNameEquals(std::string_view name, std::string_view lowerCaseLiteral) noexcept {
+			if (name.size() != lowerCaseLiteral.size()) {
+				return false;
+			}
+			for (uint64_t x = 0; x < name.size(); ++x) {
+				if (static_cast<char>(name[x] | 0x20) != lowerCaseLiteral[x]) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/// @brief Strips the optional whitespace that may surround a header value.
+		inline std::string_view trimHeaderValue(std::string_view value) noexcept {
+			while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) {
+				value.remove_prefix(1);
+			}
+			while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) {
+				value.remove_suffix(1);
+			}
+			return value;
+		}
+
+		/// @brief Parses a run of leading decimal digits, returning -1 if there are none.
+		inline int64_t parseHeaderInteger(std::string_view value) noexcept {
+			int64_t returnValue{ -1 };
+			for (auto& valueNew: value) {
+				if (valueNew < '0' || valueNew > '9') {
+					break;
+				}
+				returnValue = (returnValue < 0 ? 0 : returnValue * 10) + (valueNew - '0');
+			}
+			return returnValue;
+		}
+
+		/// @brief Parses a decimal seconds value such as "1.234" into whole milliseconds, returning -1 if there are no digits.
+		inline int64_t parseHeaderSecondsAsMs(std::string_view value) noexcept {
+			auto dotPosition = value.find('.');
+			int64_t returnValue = parseHeaderInteger(value.substr(0, dotPosition));
+			if (returnValue < 0) {
+				return -1;
+			}
+			returnValue *= 1000;
+			if (dotPosition != std::string_view::npos) {
+				int64_t scale{ 100 };
+				for (uint64_t x = dotPosition + 1; x < value.size() && value[x] >= '0' && value[x] <= '9'; ++x) {
+					if (scale > 0) {
+						returnValue += (value[x] - '0') * scale;
+						scale /= 10;
+					} else if (value[x] != '0') {
+						++returnValue;
+						break;
+					}
+				}
+			}
+			return returnValue;
+		}
+
+		bool HttpsInflater::decompress(std::string& data, HttpsContentEncoding encoding) {
+			if (!stream) {
+				stream = new z_stream{};
+				if (inflateInit2(stream, 15 + 32) != Z_OK) {
+					delete stream;
+					stream = nullptr;
+					return false;
+				}
+			}
+			didItExceedLimit = false;
+			if (decompressInternal(data, 15 + 32) ||
+				(!didItExceedLimit && encoding == HttpsContentEncoding::Deflate && decompressInternal(data, -15))) {
+				data.swap(outputBuffer);
+				return true;
+			}
+			return false;
+		}
 
-			while ((b = in.find_first_not_of(sep, b)) != std::string::npos) {
-				auto e = in.find(sep, b);
-				result.emplace_back(static_cast<std::string>(in.substr(b, e - b)));
-				b = e;
+		bool HttpsInflater::decompressInternal(std::string_view data, int32_t windowBits) {
+			if (inflateReset2(stream, windowBits) != Z_OK) {
+				return false;
+			}
+			outputBuffer.clear();
+			stream->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+			stream->avail_in = static_cast<uInt>(data.size());
+			uint64_t bytesWritten{};
+			int32_t result{ Z_OK };
+			while (result == Z_OK) {
+				if (bytesWritten == outputBuffer.size()) {
+					if (outputBuffer.size() >= maxOutputSize) {
+						didItExceedLimit = true;
+						outputBuffer.clear();
+						return false;
+					}
+					outputBuffer.resize(
+						std::min(maxOutputSize, std::max(outputBuffer.size() * 2, std::max(data.size() * 4, static_cast<uint64_t>(16384)))));
+				}
+				stream->next_out = reinterpret_cast<Bytef*>(outputBuffer.data() + bytesWritten);
+				stream->avail_out = static_cast<uInt>(outputBuffer.size() - bytesWritten);
+				result = inflate(stream, Z_NO_FLUSH);
+				bytesWritten = outputBuffer.size() - stream->avail_out;
+			}
+			outputBuffer.resize(bytesWritten);
+			return result == Z_STREAM_END;
+		}
+
+		HttpsInflater::~HttpsInflater() {
+			if (stream) {
+				inflateEnd(stream);
+				delete stream;
 			}
-			return result;
 		}
 
 		void HttpsTCPConnection::handleBuffer() {
@@ -91,19 +197,20 @@ namespace DiscordCoreAPI {
 		}
 
 		HttpsClientCore::HttpsClientCore(const std::string& botTokenNew) {
+			authorizationHeader = "Authorization: Bot " + botTokenNew + "\r\n";
 			botToken = botTokenNew;
 		}
 
 		void HttpsRnRBuilder::updateRateLimitData(RateLimitData& rateLimitData) {
 			auto connection{ static_cast<HttpsConnection*>(this) };
-			if (connection->data.responseHeaders.contains("x-ratelimit-bucket")) {
-				rateLimitData.bucket = connection->data.responseHeaders["x-ratelimit-bucket"];
+			if (!connection->data.rateLimitBucket.empty()) {
+				rateLimitData.bucket = std::move(connection->data.rateLimitBucket);
 			}
-			if (connection->data.responseHeaders.contains("x-ratelimit-reset-after")) {
-				rateLimitData.sRemain.store(Seconds{ static_cast<int64_t>(ceil(stod(connection->data.responseHeaders["x-ratelimit-reset-after"]))) });
+			if (connection->data.rateLimitResetAfterMs >= 0) {
+				rateLimitData.sRemain.store(Seconds{ (connection->data.rateLimitResetAfterMs + 999) / 1000 });
 			}
-			if (connection->data.responseHeaders.contains("x-ratelimit-remaining")) {
-				rateLimitData.getsRemaining.store(static_cast<int64_t>(stoi(connection->data.responseHeaders["x-ratelimit-remaining"])));
+			if (connection->data.rateLimitRemaining >= 0) {
+				rateLimitData.getsRemaining.store(connection->data.rateLimitRemaining);
 			}
 			if (rateLimitData.getsRemaining.load() <= 1 || rateLimitData.areWeASpecialBucket.load()) {
 				rateLimitData.doWeWait.store(true);
@@ -112,159 +219,282 @@ namespace DiscordCoreAPI {
 
 		HttpsResponseData HttpsRnRBuilder::finalizeReturnValues(RateLimitData& rateLimitData) {
 			auto connection{ static_cast<HttpsConnection*>(this) };
-			if (connection->data.responseData.size() >= connection->data.contentLength && connection->data.contentLength > 0) {
-				connection->data.responseData = connection->data.responseData.substr(0, connection->data.contentLength);
-			} else {
-				auto pos1 = connection->data.responseData.find_first_of('{');
-				auto pos2 = connection->data.responseData.find_last_of('}');
-				auto pos3 = connection->data.responseData.find_first_of('[');
-				auto pos4 = connection->data.responseData.find_last_of(']');
-				if (pos1 != std::string::npos && pos2 != std::string::npos && pos1 < pos3) {
-					connection->data.responseData = connection->data.responseData.substr(pos1, pos2 + 1);
-				} else if (pos3 != std::string::npos && pos4 != std::string::npos) {
-					connection->data.responseData = connection->data.responseData.substr(pos3, pos4 + 1);
+			if (connection->data.contentEncoding != HttpsContentEncoding::Identity && !connection->data.responseData.empty()) {
+				if (!connection->inflater.decompress(connection->data.responseData, connection->data.contentEncoding)) {
+					MessagePrinter::printError<PrintMessageType::Https>(
+						connection->workload.callStack + "::finalizeReturnValues(), Failed to decompress the response body.");
+					connection->data.responseData.clear();
+					if (connection->inflater.didItExceedLimit) {
+						connection->data.responseCode = static_cast<uint32_t>(HttpsResponseCode::HttpsResponseCodes::Payload_Too_Large);
+					}
 				}
 			}
 			updateRateLimitData(rateLimitData);
 			return std::move(connection->data);
 		}
 
-		std::string HttpsRnRBuilder::buildRequest(const HttpsWorkloadData& workload) {
-			std::string baseUrlNew{};
-			if (workload.baseUrl.find(".com") != std::string::npos) {
-				baseUrlNew = workload.baseUrl.substr(workload.baseUrl.find("https://") + std::string("https://").size(),
-					workload.baseUrl.find(".com") + std::string(".com").size() - std::string("https://").size());
-			} else if (workload.baseUrl.find(".org") != std::string::npos) {
-				baseUrlNew = workload.baseUrl.substr(workload.baseUrl.find("https://") + std::string("https://").size(),
-					workload.baseUrl.find(".org") + std::string(".org").size() - std::string("https://").size());
-			}
-			std::string returnString{};
-			if (workload.workloadClass == HttpsWorkloadClass::Get || workload.workloadClass == HttpsWorkloadClass::Delete) {
-				if (workload.workloadClass == HttpsWorkloadClass::Get) {
-					returnString += "GET " + workload.baseUrl + workload.relativePath + " HTTP/1.1\r\n";
-				} else if (workload.workloadClass == HttpsWorkloadClass::Delete) {
-					returnString += "DELETE " + workload.baseUrl + workload.relativePath + " HTTP/1.1\r\n";
-				}
-				for (auto& [key, value]: workload.headersToInsert) {
-					returnString += key + ": " + value + "\r\n";
-				}
-				returnString += "pragma: no-cache\r\n";
-				returnString += "Connection: keep-alive\r\n";
-				returnString += "Host: " + baseUrlNew + "\r\n\r\n";
-			} else {
-				if (workload.workloadClass == HttpsWorkloadClass::Patch) {
-					returnString += "PATCH " + workload.baseUrl + workload.relativePath + " HTTP/1.1\r\n";
-				} else if (workload.workloadClass == HttpsWorkloadClass::Post) {
-					returnString += "POST " + workload.baseUrl + workload.relativePath + " HTTP/1.1\r\n";
-				} else if (workload.workloadClass == HttpsWorkloadClass::Put) {
-					returnString = "PUT " + workload.baseUrl + workload.relativePath + " HTTP/1.1\r\n";
+		bool HttpsRequestTemplate::matches(const HttpsWorkloadData& workload, std::string_view authorizationNew) const {
+			return isItBuilt && workloadClass == workload.workloadClass && payloadType == workload.payloadType &&
+				acceptCompressed == workload.acceptCompressed && baseUrl == workload.baseUrl && authorization == authorizationNew;
+		}
+
+		void HttpsRnRBuilder::buildRequestTemplate(const HttpsWorkloadData& workload, std::string_view authorization) {
+			std::string_view host{};
+			std::string_view baseUrl{ workload.baseUrl };
+			if (auto hostEnd = baseUrl.find(".com"); hostEnd != std::string_view::npos) {
+				host = baseUrl.substr(0, hostEnd + std::string_view{ ".com" }.size());
+			} else if (hostEnd = baseUrl.find(".org"); hostEnd != std::string_view::npos) {
+				host = baseUrl.substr(0, hostEnd + std::string_view{ ".org" }.size());
+			}
+			if (auto schemeEnd = host.find("https://"); schemeEnd != std::string_view::npos) {
+				host = host.substr(schemeEnd + std::string_view{ "https://" }.size());
+			}
+			requestTemplate.workloadClass = workload.workloadClass;
+			requestTemplate.payloadType = workload.payloadType;
+			requestTemplate.acceptCompressed = workload.acceptCompressed;
+			requestTemplate.baseUrl = workload.baseUrl;
+			requestTemplate.authorization = authorization;
+			switch (workload.workloadClass) {
+				case HttpsWorkloadClass::Get: {
+					requestTemplate.requestLineStart = "GET ";
+					break;
+				}
+				case HttpsWorkloadClass::Put: {
+					requestTemplate.requestLineStart = "PUT ";
+					break;
 				}
-				for (auto& [key, value]: workload.headersToInsert) {
-					returnString += key + ": " + value + "\r\n";
+				case HttpsWorkloadClass::Post: {
+					requestTemplate.requestLineStart = "POST ";
+					break;
 				}
-				returnString += "pragma: no-cache\r\n";
-				returnString += "Connection: keep-alive\r\n";
-				returnString += "Host: " + baseUrlNew + "\r\n";
-				returnString += "Content-Length: " + std::to_string(workload.content.size()) + "\r\n\r\n";
-				returnString += workload.content;
+				case HttpsWorkloadClass::Patch: {
+					requestTemplate.requestLineStart = "PATCH ";
+					break;
+				}
+				case HttpsWorkloadClass::Delete: {
+					requestTemplate.requestLineStart = "DELETE ";
+					break;
+				}
+			}
+			requestTemplate.requestLineStart += workload.baseUrl;
+			requestTemplate.staticHeaders.clear();
+			if (!authorization.empty()) {
+				requestTemplate.staticHeaders += authorization;
+				requestTemplate.staticHeaders += "User-Agent: DiscordBot (https://discordcoreapi.com/ 1.0)\r\n";
+				if (workload.payloadType == PayloadType::Application_Json) {
+					requestTemplate.staticHeaders += "Content-Type: application/json\r\n";
+				} else if (workload.payloadType == PayloadType::Multipart_Form) {
+					requestTemplate.staticHeaders += "Content-Type: multipart/form-data; boundary=boundary25\r\n";
+				}
+			}
+			if (workload.acceptCompressed) {
+				requestTemplate.staticHeaders += "Accept-Encoding: gzip, deflate\r\n";
 			}
-			return returnString;
+			requestTemplate.staticHeaders += "pragma: no-cache\r\n";
+			requestTemplate.staticHeaders += "Connection: keep-alive\r\n";
+			requestTemplate.staticHeaders += "Host: ";
+			requestTemplate.staticHeaders += host;
+			requestTemplate.staticHeaders += "\r\n";
+			requestTemplate.isItBuilt = true;
+		}
+
+		std::string_view HttpsRnRBuilder::buildRequest(const HttpsWorkloadData& workload, std::string_view authorization) {
+			if (!requestTemplate.matches(workload, authorization)) {
+				buildRequestTemplate(workload, authorization);
+			}
+			bool hasBody{ workload.workloadClass != HttpsWorkloadClass::Get && workload.workloadClass != HttpsWorkloadClass::Delete };
+			uint64_t requestSize{ requestTemplate.requestLineStart.size() + workload.relativePath.size() + requestTemplate.staticHeaders.size() +
+				(hasBody ? workload.content.size() : 0) + maxFramingSize };
+			for (auto& [key, value]: workload.headersToInsert) {
+				requestSize += key.size() + value.size() + 4;
+			}
+			requestBuffer.clear();
+			requestBuffer.reserve(requestSize);
+			requestBuffer += requestTemplate.requestLineStart;
+			requestBuffer += workload.relativePath;
+			requestBuffer += " HTTP/1.1\r\n";
+			for (auto& [key, value]: workload.headersToInsert) {
+				requestBuffer += key;
+				requestBuffer += ": ";
+				requestBuffer += value;
+				requestBuffer += "\r\n";
+			}
+			requestBuffer += requestTemplate.staticHeaders;
+			if (hasBody) {
+				char contentLength[20]{};
+				auto result = std::to_chars(contentLength, contentLength + std::size(contentLength), workload.content.size());
+				requestBuffer += "Content-Length: ";
+				requestBuffer.append(contentLength, static_cast<uint64_t>(result.ptr - contentLength));
+				requestBuffer += "\r\n\r\n";
+				requestBuffer += workload.content;
+			} else {
+				requestBuffer += "\r\n";
+			}
+			return requestBuffer;
 		}
 
 		bool HttpsRnRBuilder::parseHeaders() {
 			auto connection{ static_cast<HttpsConnection*>(this) };
-			auto stringViewNew = static_cast<std::string>(connection->inputBufferReal);
-			if (stringViewNew.find("\r\n\r\n") != std::string::npos) {
-				auto headers = tokenize(stringViewNew);
-				std::string statusLine = headers[0];
-				headers.erase(headers.begin());
-				if (headers.size()) {
-					headers.erase(headers.begin());
-					Jsonifier::Vector<std::string> requestStatus = tokenize(statusLine, " ");
-					if (requestStatus.size() >= 3 && (requestStatus[0] == "HTTP/1.1" || requestStatus[0] == "HTTP/1.0") &&
-						atoi(requestStatus[1].c_str())) {
-						for (auto& hd: headers) {
-							std::string::size_type sep = hd.find(": ");
-							if (sep != std::string::npos) {
-								std::string key = hd.substr(0, sep);
-								std::string value = hd.substr(sep + 2, hd.length());
-								std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) {
-									return std::tolower(c);
-								});
-								connection->data.responseHeaders.emplace(key, value);
+			std::string_view buffer{ connection->inputBufferReal };
+			auto headersEnd = buffer.find("\r\n\r\n");
+			if (headersEnd == std::string_view::npos) {
+				return false;
+			}
+			auto lineEnd = buffer.find("\r\n");
+			std::string_view statusLine{ buffer.substr(0, lineEnd) };
+			if (statusLine.size() < 12 || (statusLine.substr(0, 9) != "HTTP/1.1 " && statusLine.substr(0, 9) != "HTTP/1.0 ")) {
+				return true;
+			}
+			auto responseCode = parseHeaderInteger(statusLine.substr(9, 3));
+			if (responseCode <= 0) {
+				return true;
+			}
+			connection->data.contentLength = std::numeric_limits<uint32_t>::max();
+			connection->data.isItChunked = false;
+			std::string_view location{};
+			auto lineStart = lineEnd + 2;
+			while (lineStart < headersEnd) {
+				lineEnd = buffer.find("\r\n", lineStart);
+				std::string_view line{ buffer.substr(lineStart, lineEnd - lineStart) };
+				lineStart = lineEnd + 2;
+				auto separator = line.find(':');
+				if (separator == std::string_view::npos) {
+					continue;
+				}
+				std::string_view key{ line.substr(0, separator) };
+				std::string_view value{ trimHeaderValue(line.substr(separator + 1)) };
+				if (headerNameEquals(key, "content-length")) {
+					auto contentLength = parseHeaderInteger(value);
+					if (contentLength >= 0) {
+						connection->data.contentLength = static_cast<uint64_t>(contentLength);
+					}
+				} else if (headerNameEquals(key, "content-encoding")) {
+					if (value.find("gzip") != std::string_view::npos) {
+						connection->data.contentEncoding = HttpsContentEncoding::Gzip;
+					} else if (value.find("deflate") != std::string_view::npos) {
+						connection->data.contentEncoding = HttpsContentEncoding::Deflate;
+					}
+				} else if (headerNameEquals(key, "transfer-encoding")) {
+					if (value.find("chunked") != std::string_view::npos) {
+						connection->data.isItChunked = true;
+					}
+				} else if (headerNameEquals(key, "x-ratelimit-bucket")) {
+					connection->data.rateLimitBucket.assign(value.data(), value.size());
+				} else if (headerNameEquals(key, "x-ratelimit-remaining")) {
+					connection->data.rateLimitRemaining = parseHeaderInteger(value);
+				} else if (headerNameEquals(key, "x-ratelimit-reset-after")) {
+					connection->data.rateLimitResetAfterMs = parseHeaderSecondsAsMs(value);
+				} else if (headerNameEquals(key, "retry-after")) {
+					connection->data.retryAfterMs = parseHeaderSecondsAsMs(value);
+				} else if (headerNameEquals(key, "x-ratelimit-global")) {
+					connection->data.isItGlobalRateLimit = headerNameEquals(value, "true");
+				} else if (headerNameEquals(key, "x-ratelimit-scope")) {
+					connection->data.isItGlobalRateLimit = connection->data.isItGlobalRateLimit || headerNameEquals(value, "global");
+				} else if (headerNameEquals(key, "location")) {
+					location = value;
+				}
+				for (auto& headerName: connection->workload.headersToCollect) {
+					if (headerNameEquals(key, headerName)) {
+						connection->data.responseHeaders.emplace(headerName, std::string{ value });
+						break;
+					}
+				}
+			}
+			if (connection->data.isItChunked) {
+				connection->data.contentLength = 0;
+				connection->data.currentState = HttpsState::Collecting_Chunked_Contents;
+			}
+			connection->data.responseCode = static_cast<uint32_t>(responseCode);
+			if (connection->data.responseCode == 302) {
+				connection->workload.baseUrl = static_cast<std::string>(location);
+				connection->disconnect();
+				return false;
+			}
+			connection->inputBufferReal.erase(headersEnd + 4);
+			if (connection->data.responseCode != 200 && connection->data.responseCode != 201) {
+				connection->data.currentState = HttpsState::Complete;
+			} else if (!connection->data.isItChunked) {
+				connection->data.currentState = HttpsState::Collecting_Contents;
+			}
+			return true;
+		}
+
+		bool HttpsRnRBuilder::parseChunk() {
+			auto connection{ static_cast<HttpsConnection*>(this) };
+			std::string_view buffer{ connection->inputBufferReal };
+			uint64_t consumed{};
+			bool returnValue{ true };
+			while (connection->data.currentState == HttpsState::Collecting_Chunked_Contents) {
+				std::string_view remaining{ buffer.substr(consumed) };
+				if (connection->data.chunkState == HttpsChunkState::Data) {
+					if (remaining.empty()) {
+						returnValue = false;
+						break;
+					}
+					auto bytesToCopy = std::min(connection->data.chunkBytesRemaining, static_cast<uint64_t>(remaining.size()));
+					connection->data.responseData.append(remaining.data(), bytesToCopy);
+					connection->data.chunkBytesRemaining -= bytesToCopy;
+					consumed += bytesToCopy;
+					if (connection->data.chunkBytesRemaining == 0) {
+						connection->data.chunkState = HttpsChunkState::Data_End;
+					}
+					continue;
+				}
+				auto lineEnd = remaining.find("\r\n");
+				if (lineEnd == std::string_view::npos) {
+					returnValue = false;
+					break;
+				}
+				std::string_view line{ remaining.substr(0, lineEnd) };
+				consumed += lineEnd + 2;
+				switch (connection->data.chunkState) {
+					case HttpsChunkState::Size: {
+						uint64_t chunkSize{};
+						uint64_t digitCount{};
+						for (auto& value: line) {
+							if (value >= '0' && value <= '9') {
+								chunkSize = (chunkSize << 4) | static_cast<uint64_t>(value - '0');
+							} else if ((value | 0x20) >= 'a' && (value | 0x20) <= 'f') {
+								chunkSize = (chunkSize << 4) | static_cast<uint64_t>((value | 0x20) - 'a' + 10);
+							} else {
+								break;
 							}
-						}
-						if (connection->data.responseHeaders.contains("content-length")) {
-							connection->data.contentLength = stoull(connection->data.responseHeaders["content-length"]);
-						} else {
-							connection->data.contentLength = std::numeric_limits<uint32_t>::max();
-						}
-						connection->data.isItChunked = false;
-						if (connection->data.responseHeaders.contains("transfer-encoding")) {
-							if (connection->data.responseHeaders["transfer-encoding"].find("chunked") != std::string::npos) {
-								connection->data.isItChunked = true;
-								connection->data.contentLength = 0;
-								connection->data.currentState = HttpsState::Collecting_Chunked_Contents;
+							if (++digitCount > maxChunkSizeDigits) {
+								break;
 							}
 						}
-						connection->data.responseCode = atoi(requestStatus[1].c_str());
-						if (connection->data.responseCode == 302) {
-							connection->workload.baseUrl = connection->data.responseHeaders["location"];
+						if (digitCount == 0 || digitCount > maxChunkSizeDigits) {
+							MessagePrinter::printError<PrintMessageType::Https>(
+								connection->workload.callStack + "::parseChunk(), Received a malformed chunk-size line.");
+							connection->inputBufferReal.clear();
 							connection->disconnect();
 							return false;
 						}
-						if (connection->data.responseCode != 200 && connection->data.responseCode != 201) {
-							connection->inputBufferReal.erase(stringViewNew.find("\r\n\r\n") + 4);
-							connection->data.currentState = HttpsState::Complete;
-							return true;
-						} else if (!connection->data.isItChunked) {
-							connection->data.currentState = HttpsState::Collecting_Contents;
-							connection->inputBufferReal.erase(stringViewNew.find("\r\n\r\n") + 4);
-							return true;
+						if (chunkSize == 0) {
+							connection->data.chunkState = HttpsChunkState::Trailer;
 						} else {
-							connection->inputBufferReal.erase(stringViewNew.find("\r\n\r\n") + 4);
-							return true;
+							connection->data.chunkBytesRemaining = chunkSize;
+							connection->data.chunkState = HttpsChunkState::Data;
 						}
+						break;
 					}
-				}
-				return true;
-			}
-			return false;
-		}
-
-		bool HttpsRnRBuilder::parseChunk() {
-			auto connection{ static_cast<HttpsConnection*>(this) };
-			auto stringViewNew01{ static_cast<std::string>(connection->inputBufferReal) };
-			if (auto finalPosition = stringViewNew01.find("\r\n0\r\n\r\n"); finalPosition != std::string::npos) {
-				std::string responseData{};
-
-				responseData.assign(stringViewNew01.data(), stringViewNew01.size());
-
-				uint64_t pos{ 0 };
-				while (pos < responseData.size()) {
-					uint64_t lineEnd = responseData.find("\r\n", pos);
-					if (lineEnd == std::string::npos) {
+					case HttpsChunkState::Data_End: {
+						connection->data.chunkState = HttpsChunkState::Size;
 						break;
 					}
-
-					std::string sizeLine{ responseData.data() + pos, lineEnd - pos };
-					uint64_t chunkSize = std::stoul(sizeLine, nullptr, 16);
-
-					if (chunkSize == 0) {
+					case HttpsChunkState::Trailer: {
+						if (line.empty()) {
+							connection->data.currentState = HttpsState::Complete;
+						}
+						break;
+					}
+					default: {
 						break;
 					}
-
-					pos = lineEnd + 2;
-
-					std::string newString{};
-					newString.append(responseData.data() + pos, chunkSize);
-					connection->data.responseData += newString;
-					pos += chunkSize + 2;
 				}
-				connection->data.currentState = HttpsState::Complete;
-				return true;
 			}
-			return false;
+			connection->inputBufferReal.erase(consumed);
+			return returnValue;
 		}
 
 		bool HttpsRnRBuilder::parseContents() {
@@ -320,7 +550,7 @@ namespace DiscordCoreAPI {
 				std::this_thread::sleep_for(1ms);
 			}
 			connection = &connectionManager.getConnection(workload.getWorkloadType());
-			connection->theSemaphore.acquire();
+			connection->queue.acquire(HttpsRestScheduler::getLane(workload.getWorkloadType()));
 			connection->resetValues(std::move(workload));
 			if (!connection->areWeConnected()) {
 				connection->tcpConnection = HttpsTCPConnection{ connection->workload.baseUrl, static_cast<uint16_t>(443), connection };
@@ -328,9 +558,8 @@ namespace DiscordCoreAPI {
 		}
 
 		HttpsConnectionStackHolder::~HttpsConnectionStackHolder() {
-			auto value = HttpsWorkloadData::workloadIdsInternal[connection->workload.getWorkloadType()]->load();
-			HttpsWorkloadData::workloadIdsInternal[connection->workload.getWorkloadType()]->store(value + 1);
-			connection->theSemaphore.release();
+			HttpsWorkloadData::workloadIdsInternal[connection->workload.getWorkloadType()]->fetch_add(1);
+			connection->queue.release();
 		}
 
 		HttpsConnection& HttpsConnectionStackHolder::getConnection() {
@@ -338,18 +567,230 @@ namespace DiscordCoreAPI {
 		}
 
 		RateLimitStackHolder::RateLimitStackHolder(HttpsConnectionManager& connectionManager, HttpsWorkloadType workloadType) {
+			enqueuedAt = std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch());
+			lane = HttpsRestScheduler::getLane(workloadType);
+			isItExemptFromGlobalLimit = HttpsRestScheduler::isExemptFromGlobalLimit(workloadType);
 			rateLimitData = &connectionManager.getRateLimitData(workloadType);
-			rateLimitData->theSemaphore.acquire();
+		}
+
+		void RateLimitStackHolder::acquire() {
+			rateLimitData->queue.acquire(lane);
+			isItHeld.store(true);
+		}
+
+		bool RateLimitStackHolder::tryAcquireOrQueue(std::function<void()> continuation) {
+			if (rateLimitData->queue.tryAcquireOrQueue(lane, [this, continuationNew = std::move(continuation)]() {
+					isItHeld.store(true);
+					continuationNew();
+				})) {
+				isItHeld.store(true);
+				return true;
+			}
+			return false;
 		}
 
 		RateLimitStackHolder::~RateLimitStackHolder() {
-			rateLimitData->theSemaphore.release();
+			if (isItHeld.load()) {
+				rateLimitData->queue.release();
+			}
 		}
 
 		RateLimitData& RateLimitStackHolder::getRateLimitData() {
 			return *rateLimitData;
 		}
 
+		RestLane RateLimitStackHolder::getLane() const {
+			return lane;
+		}
+
+		bool RateLimitStackHolder::isExemptFromGlobalLimit() const {
+			return isItExemptFromGlobalLimit;
+		}
+
+		bool RateLimitStackHolder::takeQueueLatency(Milliseconds& queueLatency) {
+			if (wasItDequeued) {
+				queueLatency = Milliseconds{};
+				return false;
+			}
+			wasItDequeued = true;
+			queueLatency = std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) - enqueuedAt;
+			return true;
+		}
+
+		bool HttpsLaneQueue::tryAcquireOrQueue(RestLane lane, std::function<void()> continuation) {
+			std::unique_lock lock{ accessMutex };
+			bool isAnyoneAhead{ isItHeld };
+			for (uint64_t x = 0; x <= static_cast<uint64_t>(lane) && !isAnyoneAhead; ++x) {
+				isAnyoneAhead = !lanes[x].empty();
+			}
+			if (!isAnyoneAhead) {
+				isItHeld = true;
+				return true;
+			}
+			lanes[static_cast<uint64_t>(lane)].emplace_back(std::move(continuation));
+			return false;
+		}
+
+		void HttpsLaneQueue::acquire(RestLane lane) {
+			std::binary_semaphore wasItHandedOver{ 0 };
+			if (!tryAcquireOrQueue(lane, [&]() {
+					wasItHandedOver.release();
+				})) {
+				wasItHandedOver.acquire();
+			}
+		}
+
+		void HttpsLaneQueue::release() {
+			std::unique_lock lock{ accessMutex };
+			for (auto& value: lanes) {
+				if (!value.empty()) {
+					auto continuation = std::move(value.front());
+					value.pop_front();
+					lock.unlock();
+					submitToThreadPool(std::move(continuation));
+					return;
+				}
+			}
+			isItHeld = false;
+		}
+
+		bool HttpsRestScheduler::tryPassGlobalGate(RestLane lane, std::function<void()> continuation) {
+			std::unique_lock lock{ accessMutex };
+			Milliseconds currentTime{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
+			bool isAnyoneAhead{ currentTime < std::max(globalBlockedUntil, nextSlotTime) };
+			for (uint64_t x = 0; x <= static_cast<uint64_t>(lane) && !isAnyoneAhead; ++x) {
+				isAnyoneAhead = !waiters[x].empty();
+			}
+			if (!isAnyoneAhead) {
+				nextSlotTime = currentTime + Milliseconds{ 1000 / globalRequestsPerSecond };
+				return true;
+			}
+			waiters[static_cast<uint64_t>(lane)].emplace_back(std::move(continuation));
+			armWakeUp(currentTime);
+			return false;
+		}
+
+		void HttpsRestScheduler::waitOnGlobalRateLimit(RestLane lane) {
+			std::binary_semaphore didItPass{ 0 };
+			if (!tryPassGlobalGate(lane, [&]() {
+					didItPass.release();
+				})) {
+				didItPass.acquire();
+			}
+		}
+
+		void HttpsRestScheduler::armWakeUp(Milliseconds currentTime) {
+			if (wakeUpTimerId != 0) {
+				return;
+			}
+			wakeUpTimerId = NewThreadAwaiterBase::timerWheel.schedule(std::max(globalBlockedUntil, nextSlotTime) - currentTime, [this]() {
+				onWakeUp();
+			});
+		}
+
+		void HttpsRestScheduler::onWakeUp() {
+			Jsonifier::Vector<std::function<void()>> continuations{};
+			std::unique_lock lock{ accessMutex };
+			wakeUpTimerId = 0;
+			Milliseconds currentTime{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
+			for (auto& value: waiters) {
+				while (!value.empty() && currentTime >= std::max(globalBlockedUntil, nextSlotTime)) {
+					continuations.emplace_back(std::move(value.front()));
+					value.pop_front();
+					nextSlotTime = currentTime + Milliseconds{ 1000 / globalRequestsPerSecond };
+				}
+				if (!value.empty()) {
+					armWakeUp(currentTime);
+					break;
+				}
+			}
+			lock.unlock();
+			for (auto& value: continuations) {
+				submitToThreadPool(std::move(value));
+			}
+		}
+
+		void HttpsRestScheduler::closeGlobalGate(Milliseconds retryAfter) {
+			std::unique_lock lock{ accessMutex };
+			Milliseconds blockedUntil{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) + retryAfter };
+			if (blockedUntil > globalBlockedUntil) {
+				globalBlockedUntil = blockedUntil;
+			}
+		}
+
+		HttpsRestScheduler::~HttpsRestScheduler() {
+			std::unique_lock lock{ accessMutex };
+			if (wakeUpTimerId != 0) {
+				NewThreadAwaiterBase::timerWheel.cancel(wakeUpTimerId);
+			}
+		}
+
+		void HttpsRestScheduler::recordQueueLatency(RestLane lane, Milliseconds queueLatency) {
+			std::unique_lock lock{ statsMutex };
+			auto& stats = laneStats[static_cast<uint64_t>(lane)];
+			stats.totalQueueLatency += queueLatency;
+			if (queueLatency > stats.maxQueueLatency) {
+				stats.maxQueueLatency = queueLatency;
+			}
+			++stats.requestCount;
+		}
+
+		RestLaneStats HttpsRestScheduler::getLaneStats(RestLane lane) {
+			std::unique_lock lock{ statsMutex };
+			return laneStats[static_cast<uint64_t>(lane)];
+		}
+
+		RestLane HttpsRestScheduler::getLane(HttpsWorkloadType workloadType) {
+			switch (workloadType) {
+				case HttpsWorkloadType::Post_Interaction_Response:
+				case HttpsWorkloadType::Get_Interaction_Response:
+				case HttpsWorkloadType::Patch_Interaction_Response:
+				case HttpsWorkloadType::Delete_Interaction_Response:
+				case HttpsWorkloadType::Post_Followup_Message:
+				case HttpsWorkloadType::Get_Followup_Message:
+				case HttpsWorkloadType::Patch_Followup_Message:
+				case HttpsWorkloadType::Delete_Followup_Message:
+				case HttpsWorkloadType::Get_Gateway_Bot: {
+					return RestLane::Urgent;
+				}
+				case HttpsWorkloadType::Bulk_Put_Global_Application_Commands:
+				case HttpsWorkloadType::Bulk_Put_Guild_Application_Commands:
+				case HttpsWorkloadType::Bulk_Delete_Messages:
+				case HttpsWorkloadType::Get_Guild_Audit_Logs:
+				case HttpsWorkloadType::Get_Messages:
+				case HttpsWorkloadType::Get_Reactions:
+				case HttpsWorkloadType::Get_Thread_Members:
+				case HttpsWorkloadType::Get_Guild_Members:
+				case HttpsWorkloadType::Get_Search_Guild_Members:
+				case HttpsWorkloadType::Get_Guild_Bans:
+				case HttpsWorkloadType::Get_Guild_Prune_Count:
+				case HttpsWorkloadType::Post_Guild_Prune: {
+					return RestLane::Deferrable;
+				}
+				default: {
+					return RestLane::Normal;
+				}
+			}
+		}
+
+		bool HttpsRestScheduler::isExemptFromGlobalLimit(HttpsWorkloadType workloadType) {
+			switch (workloadType) {
+				case HttpsWorkloadType::Post_Interaction_Response:
+				case HttpsWorkloadType::Get_Interaction_Response:
+				case HttpsWorkloadType::Patch_Interaction_Response:
+				case HttpsWorkloadType::Delete_Interaction_Response:
+				case HttpsWorkloadType::Post_Followup_Message:
+				case HttpsWorkloadType::Get_Followup_Message:
+				case HttpsWorkloadType::Patch_Followup_Message:
+				case HttpsWorkloadType::Delete_Followup_Message: {
+					return true;
+				}
+				default: {
+					return false;
+				}
+			}
+		}
+
 		void HttpsConnectionManager::initialize() {
 			for (int64_t enumOne = static_cast<int64_t>(HttpsWorkloadType::Unset); enumOne != static_cast<int64_t>(HttpsWorkloadType::LAST);
 				 enumOne++) {
@@ -361,66 +802,349 @@ namespace DiscordCoreAPI {
 			}
 		}
 
+		HttpsReactor::HttpsReactor() {
+			thread = ThreadWrapper([this](StopToken stopToken) {
+				run(stopToken);
+			});
+		}
+
+		void HttpsReactor::submit(HttpsConnection* connection, std::function<void()> continuation) {
+			std::unique_lock lock{ accessMutex };
+			newRequests.emplace_back(PendingRequest{ std::move(continuation), connection,
+				std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) + 10000ms, connection->tcpConnection.isSetupPending() });
+			lock.unlock();
+			wakeCondition.notify_one();
+		}
+
+		void HttpsReactor::run(StopToken stopToken) {
+			UnorderedMap<uint64_t, HttpsTCPConnection*> connections{};
+			Jsonifier::Vector<uint64_t> finishedIds{};
+			Jsonifier::Vector<pollfd> setupPolls{};
+			while (!stopToken.stopRequested()) {
+				std::unique_lock lock{ accessMutex };
+				if (pendingRequests.empty()) {
+					wakeCondition.wait(lock, [&] {
+						return stopToken.stopRequested() || !newRequests.empty();
+					});
+				}
+				for (auto& value: newRequests) {
+					pendingRequests.emplace(++currentId, std::move(value));
+				}
+				newRequests.clear();
+				lock.unlock();
+				connections.clear();
+				setupPolls.clear();
+				for (auto& [key, value]: pendingRequests) {
+					if (value.isItSetup) {
+						value.connection->tcpConnection.appendSetupPolls(setupPolls);
+					} else {
+						connections.emplace(key, &value.connection->tcpConnection);
+					}
+				}
+				if (!setupPolls.empty()) {
+					poll(setupPolls.data(), static_cast<u_long>(setupPolls.size()), connections.empty() ? 10 : 0);
+					for (auto& [key, value]: pendingRequests) {
+						if (value.isItSetup) {
+							value.connection->tcpConnection.advanceSetup();
+						}
+					}
+				}
+				auto failedConnections = TCPConnection<HttpsTCPConnection>::processIO(connections, 10);
+				Milliseconds currentTime{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
+				finishedIds.clear();
+				for (auto& [key, value]: pendingRequests) {
+					if (value.isItSetup) {
+						if (!value.connection->tcpConnection.isSetupPending()) {
+							finishedIds.emplace_back(key);
+						}
+					} else if (value.connection->data.currentState == HttpsState::Complete || failedConnections.contains(key) ||
+						currentTime >= value.deadline) {
+						finishedIds.emplace_back(key);
+					}
+				}
+				for (auto& value: finishedIds) {
+					submitToThreadPool(std::move(pendingRequests[value].continuation));
+					pendingRequests.erase(value);
+				}
+			}
+		}
+
+		HttpsReactor::~HttpsReactor() {
+			std::unique_lock lock{ accessMutex };
+			thread.requestStop();
+			lock.unlock();
+			wakeCondition.notify_all();
+		}
+
+		HttpsRequestOperation::HttpsRequestOperation(HttpsClient* clientNew, HttpsWorkloadData&& workloadNew)
+			: workload{ std::move(workloadNew) }, client{ clientNew } {
+			lane = HttpsRestScheduler::getLane(workload.getWorkloadType());
+		}
+
+		void HttpsRequestOperation::start(std::coroutine_handle<> coroHandleNew) {
+			coroHandle = coroHandleNew;
+			advance(&HttpsRequestOperation::acquireConnection);
+		}
+
+		HttpsResponseData HttpsRequestOperation::takeResult() {
+			if (exception) {
+				std::rethrow_exception(exception);
+			}
+			return std::move(returnData);
+		}
+
+		HttpsConnection& HttpsRequestOperation::getConnection() {
+			return *connection;
+		}
+
+		void HttpsRequestOperation::advance(Step step) {
+			try {
+				(this->*step)();
+			} catch (...) {
+				exception = std::current_exception();
+				finish();
+			}
+		}
+
+		std::function<void()> HttpsRequestOperation::continueWith(Step step) {
+			return [this, step]() {
+				advance(step);
+			};
+		}
+
+		void HttpsRequestOperation::acquireConnection() {
+			connection = &client->connectionManager.getConnection(workload.getWorkloadType());
+			if (connection->queue.tryAcquireOrQueue(lane, continueWith(&HttpsRequestOperation::acquireBucket))) {
+				acquireBucket();
+			}
+		}
+
+		void HttpsRequestOperation::acquireBucket() {
+			isConnectionHeld = true;
+			connection->resetValues(std::move(workload));
+			rateLimitHolder = makeUnique<RateLimitStackHolder>(client->connectionManager, connection->workload.getWorkloadType());
+			if (rateLimitHolder->tryAcquireOrQueue(continueWith(&HttpsRequestOperation::waitOnBucketReset))) {
+				waitOnBucketReset();
+			}
+		}
+
+		void HttpsRequestOperation::waitOnBucketReset() {
+			Milliseconds timeRemaining{ client->collectRateLimitDelay(*connection, rateLimitHolder->getRateLimitData()) };
+			if (timeRemaining.count() > 0) {
+				auto continuation = continueWith(&HttpsRequestOperation::waitOnGlobalGate);
+				NewThreadAwaiterBase::timerWheel.schedule(timeRemaining, [continuation]() {
+					submitToThreadPool(continuation);
+				});
+				return;
+			}
+			waitOnGlobalGate();
+		}
+
+		void HttpsRequestOperation::waitOnGlobalGate() {
+			if (rateLimitHolder->isExemptFromGlobalLimit() ||
+				client->scheduler.tryPassGlobalGate(lane, continueWith(&HttpsRequestOperation::sendRequest))) {
+				sendRequest();
+			}
+		}
+
+		void HttpsRequestOperation::sendRequest() {
+			Milliseconds queueLatency{};
+			if (rateLimitHolder->takeQueueLatency(queueLatency)) {
+				client->scheduler.recordQueueLatency(lane, queueLatency);
+			}
+			connectAndWrite();
+		}
+
+		void HttpsRequestOperation::connectAndWrite() {
+			while (connection->currentReconnectTries < connection->maxReconnectTries) {
+				if (!isItConnecting && !connection->areWeConnected()) {
+					isItConnecting = true;
+					connection->currentBaseUrl = connection->workload.baseUrl;
+					connection->tcpConnection = HttpsTCPConnection{ connection };
+					connection->tcpConnection.beginSetup(connection->workload.baseUrl, static_cast<uint16_t>(443));
+					client->reactor.submit(connection, continueWith(&HttpsRequestOperation::connectAndWrite));
+					return;
+				}
+				isItConnecting = false;
+				if (connection->areWeConnected() && client->writeRequest(*connection)) {
+					client->reactor.submit(connection, continueWith(&HttpsRequestOperation::collectResponse));
+					return;
+				}
+				++connection->currentReconnectTries;
+				connection->disconnect();
+			}
+			connection->disconnect();
+			returnData = HttpsResponseData{};
+			finalizeResponse();
+		}
+
+		void HttpsRequestOperation::collectResponse() {
+			returnData = client->resumeResponse(*connection, rateLimitHolder->getRateLimitData());
+			finalizeResponse();
+		}
+
+		void HttpsRequestOperation::finalizeResponse() {
+			returnData = client->finalizeRequest(*connection, rateLimitHolder->getRateLimitData(), std::move(returnData));
+			if (returnData.responseCode == 429 && ++retryCount <= HttpsClient::maxRateLimitRetries) {
+				waitOnBucketReset();
+				return;
+			}
+			finish();
+		}
+
+		void HttpsRequestOperation::finish() {
+			rateLimitHolder.reset();
+			NewThreadAwaiterBase::threadPool.submitTask(coroHandle);
+		}
+
+		HttpsRequestOperation::~HttpsRequestOperation() {
+			rateLimitHolder.reset();
+			if (isConnectionHeld) {
+				HttpsWorkloadData::workloadIdsInternal[connection->workload.getWorkloadType()]->fetch_add(1);
+				connection->queue.release();
+			}
+		}
+
 		HttpsClient::HttpsClient(const std::string& botTokenNew) : HttpsClientCore(botTokenNew), connectionManager() {
 			connectionManager.initialize();
 		};
 
+		void HttpsClient::setResponseCacheTtl(HttpsWorkloadType workloadType, Milliseconds ttl) {
+			std::unique_lock lock{ sharedRequestMutex };
+			if (ttl.count() > 0) {
+				responseCacheTtls[workloadType] = ttl;
+			} else if (responseCacheTtls.contains(workloadType)) {
+				responseCacheTtls.erase(workloadType);
+			}
+		}
+
+		SharedRequestRole HttpsClient::joinSharedRequest(const HttpsWorkloadData& workload, std::coroutine_handle<> coroHandle,
+			std::shared_ptr<SharedRequest>& sharedRequest) {
+			if (workload.workloadClass != HttpsWorkloadClass::Get) {
+				return SharedRequestRole::Leader;
+			}
+			std::string key{ std::to_string(static_cast<uint64_t>(workload.getWorkloadType())) + " " + workload.baseUrl + workload.relativePath };
+			std::unique_lock lock{ sharedRequestMutex };
+			if (responseCache.contains(key)) {
+				auto& cachedResponse = responseCache[key];
+				if (cachedResponse.expiry > std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch())) {
+					HttpsWorkloadData::workloadIdsInternal[workload.getWorkloadType()]->fetch_add(1);
+					sharedRequest = cachedResponse.request;
+					return SharedRequestRole::Cached;
+				}
+				responseCache.erase(key);
+			}
+			if (inFlightRequests.contains(key)) {
+				HttpsWorkloadData::workloadIdsInternal[workload.getWorkloadType()]->fetch_add(1);
+				sharedRequest = inFlightRequests[key];
+				sharedRequest->waiters.emplace_back(coroHandle);
+				return SharedRequestRole::Follower;
+			}
+			sharedRequest = std::make_shared<SharedRequest>();
+			sharedRequest->workloadType = workload.getWorkloadType();
+			sharedRequest->key = std::move(key);
+			inFlightRequests.emplace(sharedRequest->key, sharedRequest);
+			return SharedRequestRole::Leader;
+		}
+
+		void HttpsClient::completeSharedRequest(const std::shared_ptr<SharedRequest>& sharedRequest) {
+			std::unique_lock lock{ sharedRequestMutex };
+			inFlightRequests.erase(sharedRequest->key);
+			if (!sharedRequest->exception && responseCacheTtls.contains(sharedRequest->workloadType)) {
+				Milliseconds currentTime{ std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()) };
+				if (responseCache.size() >= 1024) {
+					Jsonifier::Vector<std::string> expiredKeys{};
+					for (auto& [key, value]: responseCache) {
+						if (value.expiry <= currentTime) {
+							expiredKeys.emplace_back(key);
+						}
+					}
+					for (auto& value: expiredKeys) {
+						responseCache.erase(value);
+					}
+				}
+				responseCache[sharedRequest->key] = CachedResponse{ sharedRequest, currentTime + responseCacheTtls[sharedRequest->workloadType] };
+			}
+			auto waiters = std::move(sharedRequest->waiters);
+			lock.unlock();
+			for (auto& value: waiters) {
+				NewThreadAwaiterBase::threadPool.submitTask(value);
+			}
+		}
+
 		HttpsResponseData HttpsClient::httpsRequest(HttpsConnection& connection) {
-			RateLimitStackHolder rateLimitData{ connectionManager, connection.workload.workloadType };
+			RateLimitStackHolder rateLimitHolder{ connectionManager, connection.workload.workloadType };
+			rateLimitHolder.acquire();
 
-			HttpsResponseData resultData = executeByRateLimitData(connection, rateLimitData.getRateLimitData());
+			HttpsResponseData resultData = executeByRateLimitData(connection, rateLimitHolder);
 			return resultData;
 		}
 
-		HttpsResponseData HttpsClientCore::httpsRequestInternal(HttpsConnection& connection, RateLimitData& rateLimitData) {
-			if (connection.workload.baseUrl == "https://discord.com/api/v10") {
-				connection.workload.headersToInsert.emplace("Authorization", "Bot " + botToken);
-				connection.workload.headersToInsert.emplace("User-Agent", "DiscordBot (https://discordcoreapi.com/ 1.0)");
-				if (connection.workload.payloadType == PayloadType::Application_Json) {
-					connection.workload.headersToInsert.emplace("Content-Type", "application/json");
-				} else if (connection.workload.payloadType == PayloadType::Multipart_Form) {
-					connection.workload.headersToInsert.emplace("Content-Type", "multipart/form-data; boundary=boundary25");
+		RestLaneStats HttpsClient::getLaneStats(RestLane lane) {
+			return scheduler.getLaneStats(lane);
+		}
+
+		bool HttpsClientCore::sendRequest(HttpsConnection& connection) {
+			while (connection.currentReconnectTries < connection.maxReconnectTries) {
+				if (!connection.areWeConnected()) {
+					connection.currentBaseUrl = connection.workload.baseUrl;
+					connection.tcpConnection = HttpsTCPConnection{ connection.workload.baseUrl, static_cast<uint16_t>(443), &connection };
+					if (connection.tcpConnection.currentStatus != ConnectionStatus::NO_Error) {
+						++connection.currentReconnectTries;
+						connection.disconnect();
+						continue;
+					}
 				}
-			}
-			if (connection.currentReconnectTries >= connection.maxReconnectTries) {
+				if (connection.areWeConnected() && writeRequest(connection)) {
+					return true;
+				}
+				++connection.currentReconnectTries;
 				connection.disconnect();
+			}
+			connection.disconnect();
+			return false;
+		}
+
+		bool HttpsClientCore::writeRequest(HttpsConnection& connection) {
+			std::string_view authorization{};
+			if (connection.workload.baseUrl == "https://discord.com/api/v10") {
+				authorization = authorizationHeader;
+			}
+			connection.tcpConnection.writeData(connection.buildRequest(connection.workload, authorization), true);
+			return connection.tcpConnection.currentStatus == ConnectionStatus::NO_Error;
+		}
+
+		HttpsResponseData HttpsClientCore::httpsRequestInternal(HttpsConnection& connection, RateLimitData& rateLimitData) {
+			if (!sendRequest(connection)) {
 				return HttpsResponseData{};
 			}
-			if (!connection.areWeConnected()) {
-				connection.currentBaseUrl = connection.workload.baseUrl;
-				connection.tcpConnection = HttpsTCPConnection{ connection.workload.baseUrl, static_cast<uint16_t>(443), &connection };
-				if (connection.tcpConnection.currentStatus != ConnectionStatus::NO_Error) {
-					++connection.currentReconnectTries;
-					connection.disconnect();
-					return httpsRequestInternal(connection, rateLimitData);
-				}
-			}
-			auto request = connection.buildRequest(connection.workload);
-			if (connection.areWeConnected()) {
-				connection.tcpConnection.writeData(request, true);
-				if (connection.tcpConnection.currentStatus != ConnectionStatus::NO_Error) {
-					++connection.currentReconnectTries;
-					connection.disconnect();
-					return httpsRequestInternal(connection, rateLimitData);
-				}
-
-				auto resultNew = getResponse(connection, rateLimitData);
-				if (static_cast<int64_t>(resultNew.responseCode) == -1) {
-					++connection.currentReconnectTries;
-					connection.disconnect();
-					return httpsRequestInternal(connection, rateLimitData);
-				} else {
-					return resultNew;
-				}
+			auto resultNew = getResponse(connection, rateLimitData);
+			if (static_cast<int64_t>(resultNew.responseCode) == -1) {
+				++connection.currentReconnectTries;
+				connection.disconnect();
+				return httpsRequestInternal(connection, rateLimitData);
 			} else {
+				return resultNew;
+			}
+		}
+
+		HttpsResponseData HttpsClientCore::resumeResponse(HttpsConnection& connection, RateLimitData& rateLimitData) {
+			HttpsResponseData resultNew{};
+			if (connection.data.currentState == HttpsState::Complete || connection.areWeConnected()) {
+				resultNew = connection.finalizeReturnValues(rateLimitData);
+			} else {
+				resultNew = recoverFromError(connection, rateLimitData);
+			}
+			if (static_cast<int64_t>(resultNew.responseCode) == -1) {
 				++connection.currentReconnectTries;
 				connection.disconnect();
 				return httpsRequestInternal(connection, rateLimitData);
+			} else {
+				return resultNew;
 			}
 		}
 
-		HttpsResponseData HttpsClient::executeByRateLimitData(HttpsConnection& connection, RateLimitData& rateLimitData) {
-			HttpsResponseData returnData{};
+		Milliseconds HttpsClient::collectRateLimitDelay(HttpsConnection& connection, RateLimitData& rateLimitData) {
 			Milliseconds timeRemaining{};
 			Milliseconds currentTime = std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch());
 			if (connection.workload.workloadType == HttpsWorkloadType::Delete_Message_Old) {
@@ -441,6 +1165,14 @@ namespace DiscordCoreAPI {
 			}
 			if (timeRemaining.count() > 0) {
 				MessagePrinter::printSuccess<PrintMessageType::Https>("We're waiting on rate-limit: " + std::to_string(timeRemaining.count()));
+			}
+			return timeRemaining;
+		}
+
+		void HttpsClient::waitOnRateLimit(HttpsConnection& connection, RateLimitStackHolder& rateLimitHolder) {
+			Milliseconds timeRemaining{ collectRateLimitDelay(connection, rateLimitHolder.getRateLimitData()) };
+			if (timeRemaining.count() > 0) {
+				Milliseconds currentTime = std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch());
 				Milliseconds targetTime{ currentTime + timeRemaining };
 				while (targetTime > currentTime && targetTime.count() > 0 && currentTime.count() > 0 && timeRemaining.count() > 0) {
 					currentTime = std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch());
@@ -453,8 +1185,16 @@ namespace DiscordCoreAPI {
 					}
 				}
 			}
+			if (!rateLimitHolder.isExemptFromGlobalLimit()) {
+				scheduler.waitOnGlobalRateLimit(rateLimitHolder.getLane());
+			}
+			Milliseconds queueLatency{};
+			if (rateLimitHolder.takeQueueLatency(queueLatency)) {
+				scheduler.recordQueueLatency(rateLimitHolder.getLane(), queueLatency);
+			}
+		}
 
-			returnData = HttpsClient::httpsRequestInternal(connection, rateLimitData);
+		HttpsResponseData HttpsClient::finalizeRequest(HttpsConnection& connection, RateLimitData& rateLimitData, HttpsResponseData&& returnData) {
 			rateLimitData.sampledTimeInMs.store(std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()));
 
 			if (rateLimitData.tempBucket != "") {
@@ -471,17 +1211,30 @@ namespace DiscordCoreAPI {
 				MessagePrinter::printSuccess<PrintMessageType::Https>(connection.workload.callStack +
 					" Success: " + static_cast<std::string>(returnData.responseCode) + ": " + returnData.responseData);
 			} else if (returnData.responseCode == 429) {
-				if (connection.data.responseHeaders.contains("x-ratelimit-retry-after")) {
-					rateLimitData.sRemain.store(
-						Seconds{ static_cast<uint64_t>(stoull(connection.data.responseHeaders["x-ratelimit-retry-after"]) / 1000.0f) });
+				Milliseconds retryAfter{ returnData.retryAfterMs >= 0 ? returnData.retryAfterMs : 1000 };
+				if (returnData.isItGlobalRateLimit) {
+					scheduler.closeGlobalGate(retryAfter);
+				} else {
+					rateLimitData.sRemain.store(Seconds{ (retryAfter.count() + 999) / 1000 });
+					rateLimitData.doWeWait.store(true);
 				}
-				rateLimitData.doWeWait.store(true);
 				rateLimitData.sampledTimeInMs.store(std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()));
-				MessagePrinter::printError<PrintMessageType::Https>(connection.workload.callStack +
-					"::httpsRequest(), We've hit rate limit! Time Remaining: " + std::to_string(rateLimitData.sRemain.load().count()));
+				MessagePrinter::printError<PrintMessageType::Https>(connection.workload.callStack + "::httpsRequest(), We've hit " +
+					(returnData.isItGlobalRateLimit ? "the global" : "a") +
+					" rate limit! Time Remaining: " + std::to_string(retryAfter.count()) + "ms");
 				connection.resetValues(std::move(connection.workload));
-				returnData = executeByRateLimitData(connection, rateLimitData);
 			}
+			return std::move(returnData);
+		}
+
+		HttpsResponseData HttpsClient::executeByRateLimitData(HttpsConnection& connection, RateLimitStackHolder& rateLimitHolder) {
+			HttpsResponseData returnData{};
+			int32_t retryCount{};
+			do {
+				waitOnRateLimit(connection, rateLimitHolder);
+				returnData = finalizeRequest(connection, rateLimitHolder.getRateLimitData(),
+					httpsRequestInternal(connection, rateLimitHolder.getRateLimitData()));
+			} while (returnData.responseCode == 429 && ++retryCount <= maxRateLimitRetries);
 			return returnData;
 		}
 
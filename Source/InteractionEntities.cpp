@@ -456,8 +456,8 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Interaction_Response };
 		co_await NewThreadAwaitable<MessageData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath =
-			"/interactions/" + dataPackage.interactionPackage.interactionId + "/" + dataPackage.interactionPackage.interactionToken + "/callback";
+		workload.setRelativePath("/interactions/", dataPackage.interactionPackage.interactionId, "/", dataPackage.interactionPackage.interactionToken,
+			"/callback");
 		dataPackage.generateExcludedKeys();
 		if (dataPackage.data.files.size() > 0) {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
@@ -466,7 +466,7 @@ namespace DiscordCoreAPI {
 			parser.serializeJson<true>(dataPackage, workload.content);
 		}
 		workload.callStack = "Interactions::createInteractionResponseAsync()";
-		Interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Interactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		GetInteractionResponseData dataPackage01{};
 		dataPackage01.applicationId = dataPackage.interactionPackage.applicationId;
 		dataPackage01.interactionToken = dataPackage.interactionPackage.interactionToken;
@@ -481,10 +481,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Interaction_Response };
 		co_await NewThreadAwaitable<MessageData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/webhooks/" + dataPackage.applicationId + "/" + dataPackage.interactionToken + "/messages/@original";
+		workload.setRelativePath("/webhooks/", dataPackage.applicationId, "/", dataPackage.interactionToken, "/messages/@original");
 		workload.callStack = "Interactions::getInteractionResponseAsync()";
 		MessageData returnData{};
-		Interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Interactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -492,8 +492,8 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Interaction_Response };
 		co_await NewThreadAwaitable<MessageData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken +
-			"/messages/@original";
+		workload.setRelativePath("/webhooks/", dataPackage.interactionPackage.applicationId, "/", dataPackage.interactionPackage.interactionToken,
+			"/messages/@original");
 		dataPackage.generateExcludedKeys();
 		if (dataPackage.files.size() > 0) {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
@@ -503,19 +503,19 @@ namespace DiscordCoreAPI {
 		}
 		workload.callStack = "Interactions::editInteractionResponseAsync()";
 		MessageData returnData{};
-		Interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Interactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
 	CoRoutine<void> Interactions::deleteInteractionResponseAsync(DeleteInteractionResponseData dataPackage) {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Interaction_Response };
 		co_await NewThreadAwaitable<void>();
-		std::this_thread::sleep_for(Milliseconds{ dataPackage.timeDelay });
+		co_await TimeDelayAwaitable(Milliseconds{ dataPackage.timeDelay });
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken +
-			"/messages/@original";
+		workload.setRelativePath("/webhooks/", dataPackage.interactionPackage.applicationId, "/", dataPackage.interactionPackage.interactionToken,
+			"/messages/@original");
 		workload.callStack = "Interactions::deleteInteractionResponseAsync()";
-		Interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Interactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -523,7 +523,7 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Followup_Message };
 		co_await NewThreadAwaitable<MessageData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken;
+		workload.setRelativePath("/webhooks/", dataPackage.interactionPackage.applicationId, "/", dataPackage.interactionPackage.interactionToken);
 		dataPackage.generateExcludedKeys();
 		if (dataPackage.files.size() > 0) {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
@@ -533,7 +533,7 @@ namespace DiscordCoreAPI {
 		}
 		workload.callStack = "Interactions::createFollowUpMessageAsync()";
 		MessageData returnData{};
-		Interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Interactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -541,10 +541,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Followup_Message };
 		co_await NewThreadAwaitable<MessageData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/webhooks/" + dataPackage.applicationId + "/" + dataPackage.interactionToken + "/messages/" + dataPackage.messageId;
+		workload.setRelativePath("/webhooks/", dataPackage.applicationId, "/", dataPackage.interactionToken, "/messages/", dataPackage.messageId);
 		workload.callStack = "Interactions::getFollowUpMessageAsync()";
 		MessageData returnData{};
-		Interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Interactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -552,8 +552,8 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Followup_Message };
 		co_await NewThreadAwaitable<MessageData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken +
-			"/messages/" + dataPackage.messagePackage.messageId;
+		workload.setRelativePath("/webhooks/", dataPackage.interactionPackage.applicationId, "/", dataPackage.interactionPackage.interactionToken,
+			"/messages/", dataPackage.messagePackage.messageId);
 		if (dataPackage.files.size() > 0) {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
 			parser.serializeJson<true>(dataPackage, workload.content);
@@ -562,27 +562,27 @@ namespace DiscordCoreAPI {
 		}
 		workload.callStack = "Interactions::editFollowUpMessageAsync()";
 		MessageData returnData{};
-		Interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Interactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
 	CoRoutine<void> Interactions::deleteFollowUpMessageAsync(DeleteFollowUpMessageData dataPackage) {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Followup_Message };
 		co_await NewThreadAwaitable<void>();
-		std::this_thread::sleep_for(Milliseconds{ dataPackage.timeDelay });
+		co_await TimeDelayAwaitable(Milliseconds{ dataPackage.timeDelay });
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken +
-			"/messages/" + dataPackage.messagePackage.messageId;
+		workload.setRelativePath("/webhooks/", dataPackage.interactionPackage.applicationId, "/", dataPackage.interactionPackage.interactionToken,
+			"/messages/", dataPackage.messagePackage.messageId);
 		workload.callStack = "Interactions::deleteFollowUpMessageToBeWrappe()";
-		Interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Interactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
 	MessageData Interactions::createInteractionResponse(CreateInteractionResponseData dataPackage) {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Interaction_Response };
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath =
-			"/interactions/" + dataPackage.interactionPackage.interactionId + "/" + dataPackage.interactionPackage.interactionToken + "/callback";
+		workload.setRelativePath("/interactions/", dataPackage.interactionPackage.interactionId, "/", dataPackage.interactionPackage.interactionToken,
+			"/callback");
 		dataPackage.generateExcludedKeys();
 		if (dataPackage.data.files.size() > 0) {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
@@ -605,8 +605,8 @@ namespace DiscordCoreAPI {
 	MessageData Interactions::editInteractionResponse(EditInteractionResponseData dataPackage) {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Interaction_Response };
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken +
-			"/messages/@original";
+		workload.setRelativePath("/webhooks/", dataPackage.interactionPackage.applicationId, "/", dataPackage.interactionPackage.interactionToken,
+			"/messages/@original");
 		dataPackage.generateExcludedKeys();
 		if (dataPackage.files.size() > 0) {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
@@ -623,7 +623,7 @@ namespace DiscordCoreAPI {
 	MessageData Interactions::createFollowUpMessage(CreateFollowUpMessageData dataPackage) {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Followup_Message };
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken;
+		workload.setRelativePath("/webhooks/", dataPackage.interactionPackage.applicationId, "/", dataPackage.interactionPackage.interactionToken);
 		dataPackage.generateExcludedKeys();
 		if (dataPackage.files.size() > 0) {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
@@ -640,8 +640,8 @@ namespace DiscordCoreAPI {
 	MessageData Interactions::editFollowUpMessage(EditFollowUpMessageData dataPackage) {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Followup_Message };
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken +
-			"/messages/" + dataPackage.messagePackage.messageId;
+		workload.setRelativePath("/webhooks/", dataPackage.interactionPackage.applicationId, "/", dataPackage.interactionPackage.interactionToken,
+			"/messages/", dataPackage.messagePackage.messageId);
 		if (dataPackage.files.size() > 0) {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
 			parser.serializeJson<true>(dataPackage, workload.content);
@@ -658,13 +658,12 @@ namespace DiscordCoreAPI {
 		channelId = dataPackage.getChannelData().id;
 		messageId = dataPackage.getMessageData().id;
 		*interactionData = dataPackage.getInteractionData();
-		buffersMapKey = channelId + messageId;
 	}
 
 	CoRoutine<Jsonifier::Vector<SelectMenuResponseData>, false> SelectMenuCollector::collectSelectMenuData(bool getSelectMenuDataForAllNew,
 		int32_t maxWaitTimeInMsNew, int32_t maxCollectedSelectMenuCountNew, CreateInteractionResponseData errorMessageDataNew, Snowflake targetUser) {
 		co_await NewThreadAwaitable<Jsonifier::Vector<SelectMenuResponseData>, false>();
-		SelectMenuCollector::selectMenuInteractionBuffersMap[buffersMapKey] = &selectMenuIncomingInteractionBuffer;
+		collectorId = SelectMenuCollector::selectMenuCollectorRegistry.add(&selectMenuIncomingInteractionBuffer, channelId, messageId);
 		if (targetUser == 0 && !getSelectMenuDataForAllNew) {
 			getSelectMenuDataForAll = true;
 		} else {
@@ -677,28 +676,11 @@ namespace DiscordCoreAPI {
 		getSelectMenuDataForAll = getSelectMenuDataForAllNew;
 		errorMessageData = errorMessageDataNew;
 		maxTimeInMs = maxWaitTimeInMsNew;
-		run();
-		co_return std::move(responseVector);
-	}
-
-	void SelectMenuCollector::collectSelectMenuData(std::function<bool(InteractionData)> triggerFunctionNew,
-		DiscordCoreInternal::TriggerEventDelegate<void, InteractionData> functionNew) {
-		functionNew.setTestFunction(triggerFunctionNew);
-		SelectMenuCollector::selectMenuInteractionEventsMap.add(std::move(functionNew));
-	}
-
-	SelectMenuCollector::~SelectMenuCollector() {
-		if (SelectMenuCollector::selectMenuInteractionBuffersMap.contains(buffersMapKey)) {
-			SelectMenuCollector::selectMenuInteractionBuffersMap.erase(buffersMapKey);
-		}
-	}
-
-	void SelectMenuCollector::run() {
 		StopWatch<std::chrono::milliseconds> stopWatch{ Milliseconds{ maxTimeInMs } };
 		while (!doWeQuit && !stopWatch.hasTimePassed()) {
 			if (!getSelectMenuDataForAll) {
 				auto selectMenuInteractionData = makeUnique<InteractionData>();
-				if (waitForTimeToPass(selectMenuIncomingInteractionBuffer, *selectMenuInteractionData.get(), maxTimeInMs)) {
+				if (!co_await selectMenuIncomingInteractionBuffer.receive(*selectMenuInteractionData.get(), Milliseconds{ maxTimeInMs })) {
 					selectMenuId = "empty";
 					auto response = makeUnique<SelectMenuResponseData>();
 					response->selectionId = selectMenuId;
@@ -745,7 +727,7 @@ namespace DiscordCoreAPI {
 				}
 			} else {
 				auto selectMenuInteractionData = makeUnique<InteractionData>();
-				if (waitForTimeToPass(selectMenuIncomingInteractionBuffer, *selectMenuInteractionData.get(), maxTimeInMs)) {
+				if (!co_await selectMenuIncomingInteractionBuffer.receive(*selectMenuInteractionData.get(), Milliseconds{ maxTimeInMs })) {
 					selectMenuId = "empty";
 					auto response = makeUnique<SelectMenuResponseData>();
 					response->selectionId = selectMenuId;
@@ -781,17 +763,26 @@ namespace DiscordCoreAPI {
 					}
 				}
 			}
-			std::this_thread::sleep_for(1ms);
 		}
-		SelectMenuCollector::selectMenuInteractionBuffersMap.erase(buffersMapKey);
+		SelectMenuCollector::selectMenuCollectorRegistry.erase(collectorId);
+		co_return std::move(responseVector);
+	}
+
+	void SelectMenuCollector::collectSelectMenuData(std::function<bool(InteractionData)> triggerFunctionNew,
+		DiscordCoreInternal::TriggerEventDelegate<void, InteractionData> functionNew) {
+		functionNew.setTestFunction(triggerFunctionNew);
+		SelectMenuCollector::selectMenuInteractionEventsMap.add(std::move(functionNew));
+	}
+
+	SelectMenuCollector::~SelectMenuCollector() {
+		SelectMenuCollector::selectMenuCollectorRegistry.erase(collectorId);
 	}
 
 	ButtonCollector::ButtonCollector(InputEventData& dataPackage) {
 		channelId = dataPackage.getChannelData().id;
 		messageId = dataPackage.getMessageData().id;
 		*interactionData = dataPackage.getInteractionData();
-		buffersMapKey = channelId + messageId;
-		ButtonCollector::buttonInteractionBuffersMap[buffersMapKey] = &buttonIncomingInteractionBuffer;
+		collectorId = ButtonCollector::buttonCollectorRegistry.add(&buttonIncomingInteractionBuffer, channelId, messageId);
 	}
 
 	CoRoutine<Jsonifier::Vector<ButtonResponseData>, false> ButtonCollector::collectButtonData(bool getButtonDataForAllNew, int32_t maxWaitTimeInMsNew,
@@ -808,28 +799,11 @@ namespace DiscordCoreAPI {
 		getButtonDataForAll = getButtonDataForAllNew;
 		errorMessageData = errorMessageDataNew;
 		maxTimeInMs = maxWaitTimeInMsNew;
-		run();
-		co_return std::move(responseVector);
-	}
-
-	void ButtonCollector::collectButtonData(std::function<bool(InteractionData)> triggerFunctionNew,
-		DiscordCoreInternal::TriggerEventDelegate<void, InteractionData> functionNew) {
-		functionNew.setTestFunction(triggerFunctionNew);
-		ButtonCollector::buttonInteractionEventsMap.add(std::move(functionNew));
-	}
-
-	ButtonCollector::~ButtonCollector() {
-		if (ButtonCollector::buttonInteractionBuffersMap.contains(buffersMapKey)) {
-			ButtonCollector::buttonInteractionBuffersMap.erase(buffersMapKey);
-		}
-	}
-
-	void ButtonCollector::run() {
 		StopWatch<std::chrono::milliseconds> stopWatch{ Milliseconds{ maxTimeInMs } };
 		while (!doWeQuit && !stopWatch.hasTimePassed()) {
 			if (!getButtonDataForAll) {
 				auto buttonInteractionData = makeUnique<InteractionData>();
-				if (waitForTimeToPass(buttonIncomingInteractionBuffer, *buttonInteractionData.get(), maxTimeInMs)) {
+				if (!co_await buttonIncomingInteractionBuffer.receive(*buttonInteractionData.get(), Milliseconds{ maxTimeInMs })) {
 					buttonId = "empty";
 					auto response = makeUnique<ButtonResponseData>();
 					response->buttonId = buttonId;
@@ -874,7 +848,7 @@ namespace DiscordCoreAPI {
 				}
 			} else {
 				auto buttonInteractionData = makeUnique<InteractionData>();
-				if (waitForTimeToPass(buttonIncomingInteractionBuffer, *buttonInteractionData.get(), maxTimeInMs)) {
+				if (!co_await buttonIncomingInteractionBuffer.receive(*buttonInteractionData.get(), Milliseconds{ maxTimeInMs })) {
 					buttonId = "empty";
 					auto response = makeUnique<ButtonResponseData>();
 					response->buttonId = buttonId;
@@ -908,40 +882,33 @@ namespace DiscordCoreAPI {
 					doWeQuit = true;
 				}
 			}
-			std::this_thread::sleep_for(1ms);
 		}
-		ButtonCollector::buttonInteractionBuffersMap.erase(buffersMapKey);
+		ButtonCollector::buttonCollectorRegistry.erase(collectorId);
+		co_return std::move(responseVector);
+	}
+
+	void ButtonCollector::collectButtonData(std::function<bool(InteractionData)> triggerFunctionNew,
+		DiscordCoreInternal::TriggerEventDelegate<void, InteractionData> functionNew) {
+		functionNew.setTestFunction(triggerFunctionNew);
+		ButtonCollector::buttonInteractionEventsMap.add(std::move(functionNew));
+	}
+
+	ButtonCollector::~ButtonCollector() {
+		ButtonCollector::buttonCollectorRegistry.erase(collectorId);
 	}
 
 	ModalCollector::ModalCollector(InputEventData& dataPackage) {
 		channelId = dataPackage.getChannelData().id;
-		ModalCollector::modalInteractionBuffersMap[channelId] = &modalIncomingInteractionBuffer;
+		collectorId = ModalCollector::modalCollectorRegistry.add(&modalIncomingInteractionBuffer, channelId);
 	}
 
 	CoRoutine<ModalResponseData, false> ModalCollector::collectModalData(int32_t maxWaitTimeInMsNew) {
 		co_await NewThreadAwaitable<ModalResponseData, false>();
 		maxTimeInMs = maxWaitTimeInMsNew;
-		run();
-		co_return std::move(responseData);
-	}
-
-	void ModalCollector::collectModalData(std::function<bool(InteractionData)> triggerFunctionNew,
-		DiscordCoreInternal::TriggerEventDelegate<void, InteractionData> functionNew) {
-		functionNew.setTestFunction(triggerFunctionNew);
-		ModalCollector::modalInteractionEventsMap.add(std::move(functionNew));
-	}
-
-	ModalCollector::~ModalCollector() {
-		if (ModalCollector::modalInteractionBuffersMap.contains(channelId)) {
-			ModalCollector::modalInteractionBuffersMap.erase(channelId);
-		}
-	}
-
-	void ModalCollector::run() {
 		StopWatch<std::chrono::milliseconds> stopWatch{ Milliseconds{ maxTimeInMs } };
 		while (!doWeQuit && !stopWatch.hasTimePassed()) {
 			auto buttonInteractionData = makeUnique<InteractionData>();
-			if (waitForTimeToPass(modalIncomingInteractionBuffer, *buttonInteractionData.get(), maxTimeInMs)) {
+			if (!co_await modalIncomingInteractionBuffer.receive(*buttonInteractionData.get(), Milliseconds{ maxTimeInMs })) {
 				*responseData.interactionData = *buttonInteractionData;
 				responseData.channelId = buttonInteractionData->channelId;
 				responseData.customId = buttonInteractionData->data.customId;
@@ -960,12 +927,23 @@ namespace DiscordCoreAPI {
 			}
 		}
 
-		ModalCollector::modalInteractionBuffersMap.erase(channelId);
+		ModalCollector::modalCollectorRegistry.erase(collectorId);
+		co_return std::move(responseData);
+	}
+
+	void ModalCollector::collectModalData(std::function<bool(InteractionData)> triggerFunctionNew,
+		DiscordCoreInternal::TriggerEventDelegate<void, InteractionData> functionNew) {
+		functionNew.setTestFunction(triggerFunctionNew);
+		ModalCollector::modalInteractionEventsMap.add(std::move(functionNew));
+	}
+
+	ModalCollector::~ModalCollector() {
+		ModalCollector::modalCollectorRegistry.erase(collectorId);
 	}
 
-	UnorderedMap<std::string, UnboundedMessageBlock<InteractionData>*> SelectMenuCollector::selectMenuInteractionBuffersMap{};
-	UnorderedMap<std::string, UnboundedMessageBlock<InteractionData>*> ButtonCollector::buttonInteractionBuffersMap{};
-	UnorderedMap<std::string, UnboundedMessageBlock<InteractionData>*> ModalCollector::modalInteractionBuffersMap{};
+	DiscordCoreInternal::CollectorRegistry<InteractionData> SelectMenuCollector::selectMenuCollectorRegistry{};
+	DiscordCoreInternal::CollectorRegistry<InteractionData> ButtonCollector::buttonCollectorRegistry{};
+	DiscordCoreInternal::CollectorRegistry<InteractionData> ModalCollector::modalCollectorRegistry{};
 	DiscordCoreInternal::TriggerEvent<void, InteractionData> SelectMenuCollector::selectMenuInteractionEventsMap{};
 	DiscordCoreInternal::TriggerEvent<void, InteractionData> ButtonCollector::buttonInteractionEventsMap{};
 	DiscordCoreInternal::TriggerEvent<void, InteractionData> ModalCollector::modalInteractionEventsMap{};
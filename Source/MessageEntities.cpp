@@ -64,22 +64,30 @@ namespace Jsonifier {
 
 namespace DiscordCoreAPI {
 
-	template<> UnorderedMap<std::string, UnboundedMessageBlock<MessageData>*> ObjectCollector<MessageData>::objectsBuffersMap{};
+	template<> DiscordCoreInternal::CollectorRegistry<MessageData> ObjectCollector<MessageData>::collectorRegistry{};
 
-	template<> ObjectCollector<MessageData>::ObjectCollector() {
-		collectorId = std::to_string(std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()).count());
-		ObjectCollector::objectsBuffersMap[collectorId] = &objectsBuffer;
+	template<> ObjectCollector<MessageData>::ObjectCollector(Snowflake channelIdNew, Snowflake messageIdNew, Snowflake userIdNew) {
+		collectorId = ObjectCollector::collectorRegistry.add(&objectsBuffer, channelIdNew, messageIdNew, userIdNew);
 	};
 
-	template<> void ObjectCollector<MessageData>::run(std::coroutine_handle<typename DiscordCoreAPI::CoRoutine<
-			DiscordCoreAPI::ObjectCollector<DiscordCoreAPI::MessageData>::ObjectCollectorReturnData>::promise_type>& coroHandle) {
+	template<> CoRoutine<ObjectCollector<MessageData>::ObjectCollectorReturnData> ObjectCollector<MessageData>::collectObjects(
+		int32_t quantityToCollect, int32_t msToCollectForNew, ObjectFilter<MessageData> filteringFunctionNew) {
+		auto coroHandle = co_await NewThreadAwaitable<ObjectCollectorReturnData>();
+		coroHandle.promise().setStopCallback([buffer = &objectsBuffer] {
+			buffer->stop();
+		});
+		quantityOfObjectsToCollect = quantityToCollect;
+		filteringFunction = filteringFunctionNew;
+		msToCollectFor = msToCollectForNew;
 		int64_t startingTime = static_cast<int64_t>(std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()).count());
 		int64_t elapsedTime{};
 		while (elapsedTime < msToCollectFor && !coroHandle.promise().areWeStopped()) {
-			MessageData message{};
-			waitForTimeToPass<MessageData>(objectsBuffer, message, static_cast<uint64_t>(msToCollectFor - static_cast<uint64_t>(elapsedTime)));
-			if (filteringFunction(message)) {
-				objectReturnData.objects.emplace_back(message);
+			MessageData object{};
+			if (!co_await objectsBuffer.receive(object, Milliseconds{ msToCollectFor - elapsedTime })) {
+				break;
+			}
+			if (filteringFunction(object)) {
+				objectReturnData.objects.emplace_back(object);
 			}
 			if (static_cast<int32_t>(objectReturnData.objects.size()) >= quantityOfObjectsToCollect) {
 				break;
@@ -87,23 +95,11 @@ namespace DiscordCoreAPI {
 
 			elapsedTime = std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()).count() - startingTime;
 		}
-	}
-
-	template<> CoRoutine<ObjectCollector<MessageData>::ObjectCollectorReturnData> ObjectCollector<MessageData>::collectObjects(
-		int32_t quantityToCollect, int32_t msToCollectForNew, ObjectFilter<MessageData> filteringFunctionNew) {
-		auto coroHandle = co_await NewThreadAwaitable<ObjectCollectorReturnData>();
-		quantityOfObjectsToCollect = quantityToCollect;
-		filteringFunction = filteringFunctionNew;
-		msToCollectFor = msToCollectForNew;
-
-		run(coroHandle);
 		co_return std::move(objectReturnData);
 	}
 
 	template<> ObjectCollector<MessageData>::~ObjectCollector() {
-		if (ObjectCollector::objectsBuffersMap.contains(collectorId)) {
-			ObjectCollector::objectsBuffersMap.erase(collectorId);
-		}
+		ObjectCollector::collectorRegistry.erase(collectorId);
 	};
 
 	CreateMessageData::CreateMessageData(const Snowflake channelIdNew) {
@@ -181,38 +177,39 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Messages };
 		co_await NewThreadAwaitable<Jsonifier::Vector<MessageData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/messages";
+		workload.acceptCompressed = true;
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/messages");
 		if (dataPackage.aroundThisId != 0) {
-			workload.relativePath += "?around=" + std::to_string(dataPackage.aroundThisId);
+			workload.appendToRelativePath("?around=", dataPackage.aroundThisId);
 			if (dataPackage.limit != 0) {
-				workload.relativePath += "&limit=" + std::to_string(dataPackage.limit);
+				workload.appendToRelativePath("&limit=", dataPackage.limit);
 			} else {
 				workload.relativePath += "&limit=1";
 			}
 		} else if (dataPackage.beforeThisId != 0) {
-			workload.relativePath += "?before=" + dataPackage.beforeThisId;
+			workload.appendToRelativePath("?before=", dataPackage.beforeThisId);
 			if (dataPackage.limit != 0) {
-				workload.relativePath += "&limit=" + std::to_string(dataPackage.limit);
+				workload.appendToRelativePath("&limit=", dataPackage.limit);
 			} else {
 				workload.relativePath += "&limit=1";
 			}
 		} else if (dataPackage.afterThisId != 0) {
-			workload.relativePath += "?after=" + dataPackage.afterThisId;
+			workload.appendToRelativePath("?after=", dataPackage.afterThisId);
 			if (dataPackage.limit != 0) {
-				workload.relativePath += "&limit=" + std::to_string(dataPackage.limit);
+				workload.appendToRelativePath("&limit=", dataPackage.limit);
 			} else {
 				workload.relativePath += "&limit=1";
 			}
 		} else {
 			if (dataPackage.limit != 0) {
-				workload.relativePath += "?limit=" + std::to_string(dataPackage.limit);
+				workload.appendToRelativePath("?limit=", dataPackage.limit);
 			} else {
 				workload.relativePath += "&limit=1";
 			}
 		}
 		workload.callStack = "Messages::getMessagesAsync()";
 		Jsonifier::Vector<MessageData> returnData{};
-		Messages::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Messages::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -220,10 +217,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Message };
 		co_await NewThreadAwaitable<MessageData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.id;
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/messages/", dataPackage.id);
 		workload.callStack = "Messages::getMessageAsync()";
 		MessageData returnData{};
-		Messages::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Messages::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -231,7 +228,7 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Message };
 		co_await NewThreadAwaitable<MessageData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/messages";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/messages");
 		if (dataPackage.files.size() > 0) {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
 			parser.serializeJson(dataPackage, workload.content);
@@ -240,7 +237,7 @@ namespace DiscordCoreAPI {
 		}
 		workload.callStack = "Messages::createMessageAsync()";
 		MessageData returnData{};
-		Messages::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Messages::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -248,10 +245,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Crosspost_Message };
 		co_await NewThreadAwaitable<MessageData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId + "/crosspost";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/messages/", dataPackage.messageId, "/crosspost");
 		workload.callStack = "Messages::crosspostMessageAsync()";
 		MessageData returnData{};
-		Messages::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Messages::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -259,7 +256,7 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Message };
 		co_await NewThreadAwaitable<MessageData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId;
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/messages/", dataPackage.messageId);
 		if (dataPackage.files.size() > 0) {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
 			parser.serializeJson(dataPackage, workload.content);
@@ -268,7 +265,7 @@ namespace DiscordCoreAPI {
 		}
 		workload.callStack = "Messages::editMessageAsync()";
 		MessageData returnData{};
-		Messages::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Messages::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -282,15 +279,15 @@ namespace DiscordCoreAPI {
 		}
 		co_await NewThreadAwaitable<void>();
 		if (dataPackage.timeDelay > 0) {
-			std::this_thread::sleep_for(Milliseconds{ dataPackage.timeDelay });
+			co_await TimeDelayAwaitable(Milliseconds{ dataPackage.timeDelay });
 		}
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId;
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/messages/", dataPackage.messageId);
 		workload.callStack = "Messages::deleteMessageAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Messages::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Messages::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -298,12 +295,12 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Bulk_Delete_Messages };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/messages/bulk-delete";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/messages/bulk-delete");
 		parser.serializeJson(dataPackage, workload.content);
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Messages::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Messages::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -311,10 +308,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Pinned_Messages };
 		co_await NewThreadAwaitable<Jsonifier::Vector<MessageData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/pins";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/pins");
 		workload.callStack = "Messages::getPinnedMessagesAsync()";
 		Jsonifier::Vector<MessageData> returnData{};
-		Messages::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Messages::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -322,12 +319,12 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Put_Pin_Message };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Put;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/pins/" + dataPackage.messageId;
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/pins/", dataPackage.messageId);
 		workload.callStack = "Messages::pinMessageAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Messages::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Messages::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -335,12 +332,12 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Pin_Message };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/pins/" + dataPackage.messageId;
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/pins/", dataPackage.messageId);
 		workload.callStack = "Messages::unpinMessageAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Messages::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Messages::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -52,22 +52,30 @@ namespace Jsonifier {
 
 namespace DiscordCoreAPI {
 
-	template<> UnorderedMap<std::string, UnboundedMessageBlock<ReactionData>*> ObjectCollector<ReactionData>::objectsBuffersMap{};
+	template<> DiscordCoreInternal::CollectorRegistry<ReactionData> ObjectCollector<ReactionData>::collectorRegistry{};
 
-	template<> ObjectCollector<ReactionData>::ObjectCollector() {
-		collectorId = std::to_string(std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()).count());
-		ObjectCollector::objectsBuffersMap[collectorId] = &objectsBuffer;
+	template<> ObjectCollector<ReactionData>::ObjectCollector(Snowflake channelIdNew, Snowflake messageIdNew, Snowflake userIdNew) {
+		collectorId = ObjectCollector::collectorRegistry.add(&objectsBuffer, channelIdNew, messageIdNew, userIdNew);
 	};
 
-	template<> void ObjectCollector<ReactionData>::run(std::coroutine_handle<typename DiscordCoreAPI::CoRoutine<
-			DiscordCoreAPI::ObjectCollector<DiscordCoreAPI::ReactionData>::ObjectCollectorReturnData>::promise_type>& coroHandle) {
+	template<> CoRoutine<ObjectCollector<ReactionData>::ObjectCollectorReturnData> ObjectCollector<ReactionData>::collectObjects(
+		int32_t quantityToCollect, int32_t msToCollectForNew, ObjectFilter<ReactionData> filteringFunctionNew) {
+		auto coroHandle = co_await NewThreadAwaitable<ObjectCollectorReturnData>();
+		coroHandle.promise().setStopCallback([buffer = &objectsBuffer] {
+			buffer->stop();
+		});
+		quantityOfObjectsToCollect = quantityToCollect;
+		filteringFunction = filteringFunctionNew;
+		msToCollectFor = msToCollectForNew;
 		int64_t startingTime = static_cast<int64_t>(std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()).count());
 		int64_t elapsedTime{};
 		while (elapsedTime < msToCollectFor && !coroHandle.promise().areWeStopped()) {
-			ReactionData message{};
-			waitForTimeToPass<ReactionData>(objectsBuffer, message, static_cast<uint64_t>(msToCollectFor - static_cast<uint64_t>(elapsedTime)));
-			if (filteringFunction(message)) {
-				objectReturnData.objects.emplace_back(message);
+			ReactionData object{};
+			if (!co_await objectsBuffer.receive(object, Milliseconds{ msToCollectFor - elapsedTime })) {
+				break;
+			}
+			if (filteringFunction(object)) {
+				objectReturnData.objects.emplace_back(object);
 			}
 			if (static_cast<int32_t>(objectReturnData.objects.size()) >= quantityOfObjectsToCollect) {
 				break;
@@ -75,23 +83,11 @@ namespace DiscordCoreAPI {
 
 			elapsedTime = std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch()).count() - startingTime;
 		}
-	}
-
-	template<> CoRoutine<ObjectCollector<ReactionData>::ObjectCollectorReturnData> ObjectCollector<ReactionData>::collectObjects(
-		int32_t quantityToCollect, int32_t msToCollectForNew, ObjectFilter<ReactionData> filteringFunctionNew) {
-		auto coroHandle = co_await NewThreadAwaitable<ObjectCollectorReturnData>();
-		quantityOfObjectsToCollect = quantityToCollect;
-		filteringFunction = filteringFunctionNew;
-		msToCollectFor = msToCollectForNew;
-
-		run(coroHandle);
 		co_return std::move(objectReturnData);
 	}
 
 	template<> ObjectCollector<ReactionData>::~ObjectCollector() {
-		if (ObjectCollector::objectsBuffersMap.contains(collectorId)) {
-			ObjectCollector::objectsBuffersMap.erase(collectorId);
-		}
+		ObjectCollector::collectorRegistry.erase(collectorId);
 	};
 
 	void Reactions::initialize(DiscordCoreInternal::HttpsClient* client) {
@@ -108,11 +104,10 @@ namespace DiscordCoreAPI {
 			emoji = dataPackage.emojiName;
 		}
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Put;
-		workload.relativePath =
-			"/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId + "/reactions/" + urlEncode(emoji) + "/@me";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/messages/", dataPackage.messageId, "/reactions/", urlEncode(emoji), "/@me");
 		workload.callStack = "Reactions::createReactionAsync()";
 		ReactionData returnData{};
-		Reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Reactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -126,10 +121,9 @@ namespace DiscordCoreAPI {
 			emoji = dataPackage.emojiName;
 		}
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath =
-			"/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId + "/reactions/" + urlEncode(emoji) + "/@me";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/messages/", dataPackage.messageId, "/reactions/", urlEncode(emoji), "/@me");
 		workload.callStack = "Reactions::deleteOwnReactionAsync()";
-		Reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Reactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -144,10 +138,10 @@ namespace DiscordCoreAPI {
 			emoji = dataPackage.emojiName;
 		}
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath =
-			"/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId + "/reactions/" + urlEncode(emoji) + "/" + dataPackage.userId;
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/messages/", dataPackage.messageId, "/reactions/", urlEncode(emoji), "/",
+			dataPackage.userId);
 		workload.callStack = "Reactions::deleteUserReactionAsync()";
-		Reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Reactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -155,18 +149,18 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Reactions };
 		co_await NewThreadAwaitable<Jsonifier::Vector<UserData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId + "/reactions/" + dataPackage.emoji;
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/messages/", dataPackage.messageId, "/reactions/", dataPackage.emoji);
 		if (dataPackage.afterId != 0) {
-			workload.relativePath += "?after=" + dataPackage.afterId;
+			workload.appendToRelativePath("?after=", dataPackage.afterId);
 			if (dataPackage.limit != 0) {
-				workload.relativePath += "&limit=" + std::to_string(dataPackage.limit);
+				workload.appendToRelativePath("&limit=", dataPackage.limit);
 			}
 		} else if (dataPackage.limit != 0) {
-			workload.relativePath += "?limit=" + std::to_string(dataPackage.limit);
+			workload.appendToRelativePath("?limit=", dataPackage.limit);
 		}
 		workload.callStack = "Reactions::getReactionsAsync()";
 		Jsonifier::Vector<UserData> returnData{};
-		Reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Reactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -175,9 +169,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_All_Reactions };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId + "/reactions";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/messages/", dataPackage.messageId, "/reactions");
 		workload.callStack = "Reactions::deleteAllReactionsAsync()";
-		Reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Reactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -191,9 +185,9 @@ namespace DiscordCoreAPI {
 			emoji = dataPackage.emojiName;
 		}
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId + "/reactions/" + urlEncode(emoji);
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/messages/", dataPackage.messageId, "/reactions/", urlEncode(emoji));
 		workload.callStack = "Reactions::deleteReactionsByEmojiAsync()";
-		Reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Reactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -201,10 +195,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Emoji_List };
 		co_await NewThreadAwaitable<Jsonifier::Vector<EmojiData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/emojis";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/emojis");
 		workload.callStack = "Reactions::getEmojiListAsync()";
 		Jsonifier::Vector<EmojiData> returnData{};
-		Reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Reactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -212,10 +206,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Emoji };
 		co_await NewThreadAwaitable<EmojiData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/emojis/" + dataPackage.emojiId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/emojis/", dataPackage.emojiId);
 		workload.callStack = "Reactions::getGuildEmojiAsync()";
 		EmojiData returnData{};
-		Reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Reactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -241,14 +235,14 @@ namespace DiscordCoreAPI {
 				break;
 			}
 		}
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/emojis";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/emojis");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Reactions::createGuildEmojiAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		EmojiData returnData{};
-		Reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Reactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -256,14 +250,14 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Guild_Emoji };
 		co_await NewThreadAwaitable<EmojiData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/emojis/" + dataPackage.emojiId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/emojis/", dataPackage.emojiId);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Reactions::modifyGuildEmojiAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		EmojiData returnData{};
-		Reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Reactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -271,12 +265,12 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Guild_Emoji };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/emojis/" + dataPackage.emojiId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/emojis/", dataPackage.emojiId);
 		workload.callStack = "Reactions::deleteGuildEmojiAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Reactions::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
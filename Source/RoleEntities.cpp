@@ -150,12 +150,12 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Put_Guild_Member_Role };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Put;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/members/" + dataPackage.userId + "/roles/" + dataPackage.roleId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/members/", dataPackage.userId, "/roles/", dataPackage.roleId);
 		workload.callStack = "Roles::addGuildMemberRoleAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Roles::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Roles::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -163,12 +163,12 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Guild_Member_Role };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/members/" + dataPackage.userId + "/roles/" + dataPackage.roleId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/members/", dataPackage.userId, "/roles/", dataPackage.roleId);
 		workload.callStack = "Roles::removeGuildMemberRoleAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Roles::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Roles::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -179,10 +179,10 @@ namespace DiscordCoreAPI {
 			throw DCAException{ "Roles::getGuildRolesAsync() Error: Sorry, but you forgot to set the guildId!" };
 		}
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/roles";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/roles");
 		workload.callStack = "Roles::getGuildRolesAsync()";
 		Jsonifier::Vector<RoleData> returnData{};
-		Roles::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Roles::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -190,14 +190,14 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Guild_Role };
 		co_await NewThreadAwaitable<RoleData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/roles";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/roles");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Roles::createGuildRoleAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		RoleData returnData{};
-		Roles::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Roles::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		ModifyGuildRolePositionsData newDataPackage{};
 		newDataPackage.guildId = dataPackage.guildId;
 		newDataPackage.newPosition = dataPackage.position;
@@ -240,14 +240,14 @@ namespace DiscordCoreAPI {
 		newDataPos.rolePosition = dataPackage.newPosition;
 		dataPackage.rolePositions.emplace_back(newDataPos);
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/roles";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/roles");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Roles::modifyGuildRolePositionsAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		Jsonifier::Vector<RoleData> returnData{};
-		Roles::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Roles::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -255,7 +255,7 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Guild_Role };
 		co_await NewThreadAwaitable<RoleData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/roles/" + dataPackage.roleId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/roles/", dataPackage.roleId);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Roles::modifyGuildRoleAsync()";
 		if (dataPackage.reason != "") {
@@ -265,7 +265,7 @@ namespace DiscordCoreAPI {
 		if (cache.contains(data.id)) {
 			data = cache[data.id];
 		}
-		Roles::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		co_await Roles::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), data);
 		if (doWeCacheRolesBool) {
 			insertRole(static_cast<RoleCacheData>(data));
 		}
@@ -276,12 +276,12 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Guild_Role };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/roles/" + dataPackage.roleId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/roles/", dataPackage.roleId);
 		workload.callStack = "Roles::removeGuildRoleAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Roles::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Roles::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
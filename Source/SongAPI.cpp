@@ -33,24 +33,29 @@
 #include <discordcoreapi/VoiceConnection.hpp>
 #include <discordcoreapi/SoundCloudAPI.hpp>
 #include <discordcoreapi/YouTubeAPI.hpp>
+#include <discordcoreapi/Utilities/Demuxers.hpp>
 
 namespace DiscordCoreAPI {
 
-	SongAPI::SongAPI(const Snowflake guildIdNew) {
+	static constexpr uint32_t msPerOpusFrame{ 20 };
+
+	SongAPI::SongAPI(const Snowflake guildIdNew)
+		: audioDataBuffers{ DiscordCoreClient::getInstance()->getConfigManager().getAudioBufferDepthInMs() / msPerOpusFrame,
+			  DiscordCoreClient::getInstance()->getConfigManager().getAudioBufferDepthInMs() / msPerOpusFrame } {
+		prefetchAfterInFrames = DiscordCoreClient::getInstance()->getConfigManager().getAudioPrefetchAfterInMs() / msPerOpusFrame;
 		guildId = guildIdNew;
 	}
 
 	void SongAPI::onSongCompletion(std::function<CoRoutine<void, false>(SongCompletionEventData)> handler) {
-		onSongCompletionEvent.functions.clear();
+		onSongCompletionEvent.clear();
 		eventToken = onSongCompletionEvent.add(handler);
 	}
 
 	bool SongAPI::skip(const GuildMemberData& guildMember, bool wasItAFail) {
 		AudioFrameData dataFrame{};
-		audioDataBuffer.clearContents();
 		auto returnValue = DiscordCoreClient::getVoiceConnection(guildId).skip(wasItAFail);
 		dataFrame.guildMemberId = guildMember.user.id.operator const uint64_t&();
-		audioDataBuffer.send(std::move(dataFrame));
+		getActiveBuffer().clearContentsAndSend(dataFrame);
 		return returnValue;
 	}
 
@@ -79,18 +84,208 @@ namespace DiscordCoreAPI {
 	bool SongAPI::play(Song songNew, const GuildMemberData& guildMember) {
 		songNew.addedByUserId = guildMember.user.id;
 		std::unique_lock lock{ accessMutex };
-		if (taskThread.getStatus() == CoRoutineStatus::Running) {
-			taskThread.cancel();
+		auto isItTheSameSong = [&](const Song& other) {
+			return songNew.songId == other.songId && songNew.type == other.type;
+		};
+		std::unique_lock prefetchLock{ prefetchMutex };
+		if (wasItHandedOff && isItTheSameSong(currentSong)) {
+			wasItHandedOff = false;
+			return DiscordCoreClient::getVoiceConnection(guildId).play();
+		}
+		wasItHandedOff = false;
+		bool isItTheNextSong{ isThereANextSong && isItTheSameSong(nextSong) };
+		bool isItPrefetched{ isItTheNextSong && prefetchState == PrefetchState::Started && !isPrefetchCancelled };
+		uint8_t previousLane{ activeLane.load() };
+		if (isItPrefetched) {
+			switchToStandby();
+		} else {
+			isHandOffBlocked = true;
+			currentSong = songNew;
+			isPrefetchDue = false;
+			framesPlayed.store(0);
+		}
+		prefetchLock.unlock();
+		try {
+			cancelProducer(previousLane);
+			if (!isItPrefetched) {
+				if (isItTheNextSong) {
+					cancelPrefetch();
+				}
+				taskThreads[previousLane] = createProducer(songNew, audioDataBuffers[previousLane]);
+			}
+		} catch (...) {
+			prefetchLock.lock();
+			isHandOffBlocked = false;
+			throw;
+		}
+		prefetchLock.lock();
+		isHandOffBlocked = false;
+		prefetchLock.unlock();
+		if (isItPrefetched) {
+			onHandOffComplete();
+		}
+		return DiscordCoreClient::getVoiceConnection(guildId).play();
+	}
+
+	void SongAPI::setNextSong(Song songNew, const GuildMemberData& guildMember) {
+		songNew.addedByUserId = guildMember.user.id;
+		std::unique_lock lock{ accessMutex };
+		std::unique_lock prefetchLock{ prefetchMutex };
+		if (isThereANextSong && nextSong.songId == songNew.songId && nextSong.type == songNew.type) {
+			return;
 		}
-		if (songNew.type == SongType::SoundCloud) {
-			Song newerSong{ DiscordCoreClient::getSoundCloudAPI(guildMember.guildId).collectFinalSong(songNew) };
-			taskThread = DiscordCoreClient::getSoundCloudAPI(guildMember.guildId).downloadAndStreamAudio(newerSong);
+		prefetchLock.unlock();
+		cancelPrefetch();
+		prefetchLock.lock();
+		nextSong = songNew;
+		isThereANextSong = true;
+		isPrefetchCancelled = false;
+		prefetchState = PrefetchState::Waiting;
+		prefetchLock.unlock();
+		prefetchThread = prefetchSong(songNew);
+	}
 
-		} else if (songNew.type == SongType::YouTube) {
-			Song newerSong{ DiscordCoreClient::getYouTubeAPI(guildMember.guildId).collectFinalSong(songNew) };
-			taskThread = DiscordCoreClient::getYouTubeAPI(guildMember.guildId).downloadAndStreamAudio(newerSong);
-		};
-		return DiscordCoreClient::getVoiceConnection(guildMember.guildId).play();
+	BoundedMessageBlock<AudioFrameData>& SongAPI::getActiveBuffer() {
+		return audioDataBuffers[activeLane.load()];
+	}
+
+	bool SongAPI::isItTheActiveBuffer(BoundedMessageBlock<AudioFrameData>& audioDataBuffer) {
+		return &audioDataBuffer == &getActiveBuffer();
+	}
+
+	CoRoutine<void, false> SongAPI::createProducer(Song songNew, BoundedMessageBlock<AudioFrameData>& audioDataBuffer) {
+		CachedSong cachedSong{};
+		if (songNew.type == SongType::Local) {
+			return streamLocalSong(songNew, audioDataBuffer);
+		} else if (auto audioCache = DiscordCoreClient::getInstance()->getAudioCache(); audioCache && audioCache->tryOpen(songNew, cachedSong)) {
+			return streamCachedSong(songNew, std::move(cachedSong), audioDataBuffer);
+		} else if (songNew.type == SongType::SoundCloud) {
+			Song newerSong{ DiscordCoreClient::getSoundCloudAPI(guildId).collectFinalSong(songNew) };
+			return DiscordCoreClient::getSoundCloudAPI(guildId).downloadAndStreamAudio(newerSong, audioDataBuffer);
+		} else {
+			Song newerSong{ DiscordCoreClient::getYouTubeAPI(guildId).collectFinalSong(songNew) };
+			return DiscordCoreClient::getYouTubeAPI(guildId).downloadAndStreamAudio(newerSong, audioDataBuffer);
+		}
+	}
+
+	CoRoutine<void, false> SongAPI::prefetchSong(Song songNew) {
+		co_await NewThreadAwaitable<void, false>();
+		std::unique_lock lock{ prefetchMutex };
+		prefetchCondition.wait(lock, [&] {
+			return isPrefetchDue || isPrefetchCancelled;
+		});
+		if (isPrefetchCancelled) {
+			co_return;
+		}
+		uint8_t standbyLane{ static_cast<uint8_t>(activeLane.load() ^ 1) };
+		lock.unlock();
+		CoRoutine<void, false> producer{};
+		try {
+			producer = createProducer(songNew, audioDataBuffers[standbyLane]);
+		} catch (const std::exception& error) {
+			MessagePrinter::printError<PrintMessageType::General>("SongAPI::prefetchSong() Error: " + std::string{ error.what() });
+			lock.lock();
+			prefetchState = PrefetchState::Failed;
+			co_return;
+		}
+		lock.lock();
+		if (isPrefetchCancelled) {
+			lock.unlock();
+			producer.cancel();
+			co_return;
+		}
+		taskThreads[standbyLane] = std::move(producer);
+		prefetchState = PrefetchState::Started;
+		co_return;
+	}
+
+	void SongAPI::cancelPrefetch() {
+		std::unique_lock lock{ prefetchMutex };
+		isPrefetchCancelled = true;
+		prefetchCondition.notify_all();
+		lock.unlock();
+		if (prefetchThread.getStatus() == CoRoutineStatus::Running) {
+			prefetchThread.cancel();
+		}
+		lock.lock();
+		bool wasItStarted{ prefetchState == PrefetchState::Started };
+		uint8_t standbyLane{ static_cast<uint8_t>(activeLane.load() ^ 1) };
+		lock.unlock();
+		cancelProducer(standbyLane);
+		lock.lock();
+		if (wasItStarted) {
+			isSkipPending = false;
+		}
+		prefetchState = PrefetchState::Idle;
+		isThereANextSong = false;
+	}
+
+	void SongAPI::cancelProducer(uint8_t lane) {
+		if (taskThreads[lane].getStatus() == CoRoutineStatus::Running) {
+			try {
+				taskThreads[lane].cancel();
+			} catch (const std::exception& error) {
+				MessagePrinter::printError<PrintMessageType::General>("SongAPI::cancelProducer() Error: " + std::string{ error.what() });
+			}
+		}
+		audioDataBuffers[lane].clearContents();
+	}
+
+	void SongAPI::switchToStandby() {
+		activeLane.store(activeLane.load() ^ 1);
+		prefetchState = PrefetchState::Idle;
+		isPrefetchDue = false;
+		framesPlayed.store(0);
+		currentSong = nextSong;
+		isThereANextSong = false;
+	}
+
+	bool SongAPI::handOffToNextSong() {
+		std::unique_lock lock{ prefetchMutex };
+		if (prefetchState != PrefetchState::Started || isPrefetchCancelled || isHandOffBlocked) {
+			return false;
+		}
+		switchToStandby();
+		wasItHandedOff = true;
+		return true;
+	}
+
+	void SongAPI::onHandOffComplete() {
+		std::unique_lock lock{ prefetchMutex };
+		if (isSkipPending) {
+			isSkipPending = false;
+			DiscordCoreClient::getVoiceConnection(guildId).skip(wasPendingSkipAFail);
+		}
+	}
+
+	void SongAPI::onFramePlayed() {
+		if (prefetchAfterInFrames > 0 && framesPlayed.fetch_add(1) + 1 == prefetchAfterInFrames) {
+			std::unique_lock lock{ prefetchMutex };
+			isPrefetchDue = true;
+			prefetchCondition.notify_all();
+		}
+	}
+
+	void SongAPI::onDownloadComplete(BoundedMessageBlock<AudioFrameData>& audioDataBuffer, bool wasItAFail) {
+		std::unique_lock lock{ prefetchMutex };
+		if (isItTheActiveBuffer(audioDataBuffer)) {
+			isPrefetchDue = true;
+			prefetchCondition.notify_all();
+			DiscordCoreClient::getVoiceConnection(guildId).skip(wasItAFail);
+		} else if (prefetchState == PrefetchState::Waiting || prefetchState == PrefetchState::Started) {
+			isSkipPending = true;
+			wasPendingSkipAFail = wasItAFail;
+		}
+	}
+
+	bool SongAPI::onPrefetchFailed(BoundedMessageBlock<AudioFrameData>& audioDataBuffer) {
+		std::unique_lock lock{ prefetchMutex };
+		if (isItTheActiveBuffer(audioDataBuffer)) {
+			return false;
+		}
+		audioDataBuffer.clearContents();
+		prefetchState = PrefetchState::Failed;
+		return true;
 	}
 
 	bool SongAPI::areWeCurrentlyPlaying() const {
@@ -107,23 +302,110 @@ namespace DiscordCoreAPI {
 
 	bool SongAPI::stop() {
 		bool returnValue = DiscordCoreClient::getVoiceConnection(guildId).stop();
-		audioDataBuffer.clearContents();
+		getActiveBuffer().clearContents();
 		return returnValue;
 	}
 
-	void SongAPI::disconnect() {
-		if (taskThread.getStatus() == CoRoutineStatus::Running) {
-			taskThread.cancel();
+	CoRoutine<void, false> SongAPI::streamCachedSong(Song songNew, CachedSong cachedSong, BoundedMessageBlock<AudioFrameData>& audioDataBuffer) {
+		auto coroHandle = co_await NewThreadAwaitable<void, false>();
+		auto doWeStop = [&] {
+			return coroHandle.promise().areWeStopped();
+		};
+		coroHandle.promise().setStopCallback([buffer = &audioDataBuffer] {
+			buffer->wakeSenders();
+		});
+		AudioFrameData frameData{};
+		for (uint64_t x = 0; x < cachedSong.getFrameCount(); ++x) {
+			frameData.clearData();
+			frameData += cachedSong.getFrame(x);
+			frameData.type = AudioFrameType::Encoded;
+			frameData.guildMemberId = songNew.addedByUserId.operator const uint64_t&();
+			if (!audioDataBuffer.send(frameData, doWeStop)) {
+				co_return;
+			}
 		}
-		onSongCompletionEvent.erase(eventToken);
-		audioDataBuffer.clearContents();
-		StopWatch<std::chrono::milliseconds> stopWatch{ 10000ms };
-		while (DiscordCoreClient::getSoundCloudAPI(guildId).areWeWorking() || DiscordCoreClient::getYouTubeAPI(guildId).areWeWorking()) {
-			if (stopWatch.hasTimePassed()) {
-				break;
+		onDownloadComplete(audioDataBuffer);
+		frameData.clearData();
+		frameData.guildMemberId = songNew.addedByUserId.operator const uint64_t&();
+		audioDataBuffer.send(frameData, doWeStop);
+		co_return;
+	}
+
+	CoRoutine<void, false> SongAPI::streamLocalSong(Song songNew, BoundedMessageBlock<AudioFrameData>& audioDataBuffer) {
+		auto coroHandle = co_await NewThreadAwaitable<void, false>();
+		auto doWeStop = [&] {
+			return coroHandle.promise().areWeStopped();
+		};
+		coroHandle.promise().setStopCallback([buffer = &audioDataBuffer] {
+			buffer->wakeSenders();
+		});
+		AudioFrameData frameData{};
+		auto sendFrame = [&] {
+			frameData.guildMemberId = songNew.addedByUserId.operator const uint64_t&();
+			return audioDataBuffer.send(frameData, doWeStop);
+		};
+		std::filesystem::path path{ songNew.songId };
+		auto extension = path.extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](char value) {
+			return static_cast<char>(std::tolower(static_cast<unsigned char>(value)));
+		});
+		MemoryMappedFile file{};
+		bool wasItAFail{ !file.map(path) };
+		if (wasItAFail) {
+			MessagePrinter::printError<PrintMessageType::General>("SongAPI::streamLocalSong() Error: Failed to open " + songNew.songId + ".");
+		} else if (extension == ".ogg" || extension == ".opus") {
+			static constexpr uint64_t targetChunkSize{ 64 * 1024 };
+			static constexpr uint8_t capturePattern[]{ 'O', 'g', 'g', 'S' };
+			auto fileData = file.getData();
+			DiscordCoreInternal::OggDemuxer demuxer{};
+			uint64_t currentPosition{ fileData.find(capturePattern, 0, std::size(capturePattern)) };
+			while (currentPosition < fileData.size()) {
+				uint64_t nextPosition{ fileData.find(capturePattern, std::min(currentPosition + targetChunkSize, fileData.size()),
+					std::size(capturePattern)) };
+				nextPosition = std::min(nextPosition, fileData.size());
+				demuxer.writeData({ reinterpret_cast<const char*>(fileData.data() + currentPosition), nextPosition - currentPosition });
+				demuxer.proceedDemuxing();
+				currentPosition = nextPosition;
+				frameData.clearData();
+				while (demuxer.collectFrame(frameData)) {
+					if (!sendFrame()) {
+						co_return;
+					}
+					frameData.clearData();
+				}
 			}
-			std::this_thread::sleep_for(1ms);
+		} else {
+			DiscordCoreInternal::WavDemuxer demuxer{};
+			if (extension == ".wav") {
+				wasItAFail = !demuxer.openWav(file.getData());
+			} else {
+				demuxer.openRaw(file.getData());
+			}
+			frameData.clearData();
+			while (!wasItAFail && demuxer.collectFrame(frameData)) {
+				if (!sendFrame()) {
+					co_return;
+				}
+				frameData.clearData();
+			}
+		}
+		onDownloadComplete(audioDataBuffer, wasItAFail);
+		frameData.clearData();
+		sendFrame();
+		co_return;
+	}
+
+	void SongAPI::disconnect() {
+		std::unique_lock lock{ accessMutex };
+		cancelPrefetch();
+		for (uint8_t x = 0; x < std::size(taskThreads); ++x) {
+			cancelProducer(x);
 		}
+		onSongCompletionEvent.erase(eventToken);
+		lock.unlock();
+		auto deadline{ HRClock::now() + 10000ms };
+		DiscordCoreClient::getSoundCloudAPI(guildId).waitForIdle(deadline);
+		DiscordCoreClient::getYouTubeAPI(guildId).waitForIdle(deadline);
 	}
 
 	SongAPI::~SongAPI() {
@@ -90,8 +90,8 @@ namespace DiscordCoreAPI {
 				dataPackage.baseUrl = baseUrl02;
 				dataPackage.headersToInsert["User-Agent"] =
 					"Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/115.0.0.0 Safari/537.36";
-				dataPackage.relativePath = "/search?q=" + urlEncode(collectSongIdFromSearchQuery(songQuery).c_str()) +
-					"&facet=model&client_id=" + SoundCloudRequestBuilder::clientId;
+				dataPackage.setRelativePath("/search?q=", urlEncode(collectSongIdFromSearchQuery(songQuery).c_str()), "&facet=model&client_id=",
+					SoundCloudRequestBuilder::clientId);
 				dataPackage.workloadClass = HttpsWorkloadClass::Get;
 				HttpsResponseData returnData = submitWorkloadAndGetResult(std::move(dataPackage));
 				Jsonifier::Vector<Song> results{};
@@ -210,6 +210,8 @@ namespace DiscordCoreAPI {
 					dataPackage02.headersToInsert["Connection"] = "Keep-Alive";
 					dataPackage02.headersToInsert["User-Agent"] =
 						"Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/115.0.0.0 Safari/537.36";
+					dataPackage02.headersToCollect.emplace_back("x-amz-meta-bitrate");
+					dataPackage02.headersToCollect.emplace_back("x-amz-meta-duration");
 					auto headersNew = submitWorkloadAndGetResult(std::move(dataPackage02));
 					uint64_t valueBitRate{};
 					uint64_t valueLength{};
@@ -291,25 +293,46 @@ namespace DiscordCoreAPI {
 			}
 		}
 
-		void SoundCloudAPI::weFailedToDownloadOrDecode(const Song& songNew, NewThreadAwaiter<void, false> threadHandle, uint64_t currentRetries) {
+		void SoundCloudAPI::weFailedToDownloadOrDecode(const Song& songNew, BoundedMessageBlock<AudioFrameData>& audioDataBuffer,
+			NewThreadAwaiter<void, false> threadHandle, uint64_t currentRetries) {
 			std::this_thread::sleep_for(1s);
 			++currentRetries;
 			if (currentRetries <= 10) {
-				downloadAndStreamAudio(songNew, threadHandle, currentRetries);
-			} else {
+				downloadAndStreamAudio(songNew, audioDataBuffer, threadHandle, currentRetries);
+			} else if (!DiscordCoreClient::getSongAPI(guildId).onPrefetchFailed(audioDataBuffer)) {
 				GuildMemberData guildMember{ GuildMembers::getCachedGuildMember({ .guildMemberId = songNew.addedByUserId, .guildId = guildId }) };
 				DiscordCoreClient::getSongAPI(guildId).skip(guildMember, true);
 			}
 		}
 
+		SoundCloudAPI::WorkingScope::WorkingScope(SoundCloudAPI& apiNew) : api{ apiNew } {
+			std::unique_lock lock{ api.workingMutex };
+			++api.workingCount;
+		}
+
+		SoundCloudAPI::WorkingScope::~WorkingScope() {
+			std::unique_lock lock{ api.workingMutex };
+			if (--api.workingCount == 0) {
+				api.workingCondition.notify_all();
+			}
+		}
+
 		bool SoundCloudAPI::areWeWorking() {
-			return areWeWorkingBool.load();
+			std::unique_lock lock{ workingMutex };
+			return workingCount > 0;
+		}
+
+		bool SoundCloudAPI::waitForIdle(HRClock::time_point deadline) {
+			std::unique_lock lock{ workingMutex };
+			return workingCondition.wait_until(lock, deadline, [&] {
+				return workingCount == 0;
+			});
 		}
 
-		CoRoutine<void, false> SoundCloudAPI::downloadAndStreamAudio(const Song songNew, NewThreadAwaiter<void, false> threadHandle,
-			uint64_t currentReconnectTries) {
+		CoRoutine<void, false> SoundCloudAPI::downloadAndStreamAudio(const Song songNew, BoundedMessageBlock<AudioFrameData>& audioDataBuffer,
+			NewThreadAwaiter<void, false> threadHandle, uint64_t currentReconnectTries) {
+			WorkingScope workingScope{ *this };
 			try {
-				areWeWorkingBool.store(true);
 				std::coroutine_handle<CoRoutine<void, false>::promise_type> coroHandle{};
 				if (currentReconnectTries == 0) {
 					threadHandle = NewThreadAwaitable<void, false>();
@@ -332,11 +355,21 @@ namespace DiscordCoreAPI {
 				}
 				Jsonifier::Vector<std::string> buffer{};
 				OggDemuxer demuxer{};
+				auto doWeStop = [&] {
+					return coroHandle.promise().areWeStopped();
+				};
+				coroHandle.promise().setStopCallback([buffer = &audioDataBuffer] {
+					buffer->wakeSenders();
+				});
+				AudioFrameData frameData{};
+				UniquePtr<AudioCacheWriter> cacheWriter{};
+				if (auto audioCache = DiscordCoreClient::getInstance()->getAudioCache(); audioCache) {
+					cacheWriter = makeUnique<AudioCacheWriter>(audioCache->createWriter(songNew));
+				}
 				for (uint64_t x = 0; x < songNew.finalDownloadUrls.size(); ++x) {
 					HttpsResponseData result{ submitWorkloadAndGetResult(std::move(workloadVector[x])) };
 					if (result.responseCode != 200) {
-						areWeWorkingBool.store(false);
-						weFailedToDownloadOrDecode(songNew, threadHandle, currentReconnectTries);
+						weFailedToDownloadOrDecode(songNew, audioDataBuffer, threadHandle, currentReconnectTries);
 						co_return;
 					}
 
@@ -346,39 +379,42 @@ namespace DiscordCoreAPI {
 						demuxer.proceedDemuxing();
 					}
 					if (coroHandle.promise().areWeStopped()) {
-						areWeWorkingBool.store(false);
 						co_return;
 					}
 					bool didWeReceive{ true };
 					do {
-						AudioFrameData frameData{};
+						frameData.clearData();
 						didWeReceive = demuxer.collectFrame(frameData);
 						if (coroHandle.promise().areWeStopped()) {
-							areWeWorkingBool.store(false);
 							co_return;
 						}
 						if (frameData.currentSize != 0) {
 							frameData.guildMemberId = songNew.addedByUserId.operator const uint64_t&();
-							DiscordCoreClient::getSongAPI(guildId).audioDataBuffer.send(std::move(frameData));
+							if (cacheWriter) {
+								cacheWriter->writeFrame({ frameData.data.data(), static_cast<uint64_t>(frameData.currentSize) });
+							}
+							if (!audioDataBuffer.send(frameData, doWeStop)) {
+								co_return;
+							}
 						}
 					} while (didWeReceive);
 					if (coroHandle.promise().areWeStopped()) {
-						areWeWorkingBool.store(false);
 						co_return;
 					}
 					std::this_thread::sleep_for(1ms);
 				}
-				areWeWorkingBool.store(false);
-				DiscordCoreClient::getVoiceConnection(guildId).skip(false);
-				AudioFrameData frameData{};
+				if (cacheWriter) {
+					cacheWriter->finalize();
+				}
+				DiscordCoreClient::getSongAPI(guildId).onDownloadComplete(audioDataBuffer);
+				frameData.clearData();
 				frameData.guildMemberId = songNew.addedByUserId.operator const uint64_t&();
-				DiscordCoreClient::getSongAPI(guildId).audioDataBuffer.send(std::move(frameData));
+				audioDataBuffer.send(frameData, doWeStop);
 				co_return;
 			} catch (const HttpsError& error) {
 				MessagePrinter::printError<PrintMessageType::Https>(
 					"SoundCloudRequestBuilder::downloadAndStreamAudio() Error: " + std::string{ error.what() });
-				areWeWorkingBool.store(false);
-				weFailedToDownloadOrDecode(songNew, threadHandle, currentReconnectTries);
+				weFailedToDownloadOrDecode(songNew, audioDataBuffer, threadHandle, currentReconnectTries);
 			}
 			co_return;
 		};
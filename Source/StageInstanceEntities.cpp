@@ -65,7 +65,7 @@ namespace DiscordCoreAPI {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		StageInstanceData returnData{};
-		StageInstances::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await StageInstances::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -73,10 +73,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Stage_Instance };
 		co_await NewThreadAwaitable<StageInstanceData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/stage-instances/" + dataPackage.channelId;
+		workload.setRelativePath("/stage-instances/", dataPackage.channelId);
 		workload.callStack = "StageInstances::getStageInstanceAsync()";
 		StageInstanceData returnData{};
-		StageInstances::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await StageInstances::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -84,14 +84,14 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Stage_Instance };
 		co_await NewThreadAwaitable<StageInstanceData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/stage-instances/" + dataPackage.channelId;
+		workload.setRelativePath("/stage-instances/", dataPackage.channelId);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "StageInstances::modifyStageInstanceAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		StageInstanceData returnData{};
-		StageInstances::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await StageInstances::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -99,12 +99,12 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Stage_Instance };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/stage-instances/" + dataPackage.channelId;
+		workload.setRelativePath("/stage-instances/", dataPackage.channelId);
 		workload.callStack = "StageInstances::deleteStageInstanceAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		StageInstances::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await StageInstances::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 	DiscordCoreInternal::HttpsClient* StageInstances::httpsClient{};
@@ -58,10 +58,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Sticker };
 		co_await NewThreadAwaitable<StickerData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/stickers/" + dataPackage.stickerId;
+		workload.setRelativePath("/stickers/", dataPackage.stickerId);
 		workload.callStack = "Stickers::getStickerAsync()";
 		StickerData returnData{};
-		Stickers::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Stickers::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -72,7 +72,7 @@ namespace DiscordCoreAPI {
 		workload.relativePath = "/sticker-packs";
 		workload.callStack = "Stickers::getNitroStickerPacksAsync()";
 		Jsonifier::Vector<StickerPackData> returnData{};
-		Stickers::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Stickers::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -80,10 +80,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Stickers };
 		co_await NewThreadAwaitable<Jsonifier::Vector<StickerData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/stickers";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/stickers");
 		workload.callStack = "Stickers::getGuildStickersAsync()";
 		Jsonifier::Vector<StickerData> returnData{};
-		Stickers::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Stickers::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -91,14 +91,14 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Guild_Sticker };
 		co_await NewThreadAwaitable<StickerData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/stickers";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/stickers");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Stickers::createGuildStickerAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		StickerData returnData{};
-		Stickers::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Stickers::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -106,14 +106,14 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Guild_Sticker };
 		co_await NewThreadAwaitable<StickerData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/stickers/" + dataPackage.stickerId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/stickers/", dataPackage.stickerId);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Stickers::modifyGuildStickerAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		StickerData returnData{};
-		Stickers::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Stickers::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -121,12 +121,12 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Guild_Sticker };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/stickers/" + dataPackage.stickerId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/stickers/", dataPackage.stickerId);
 		workload.callStack = "Stickers::deleteGuildStickerAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
-		Stickers::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Stickers::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -74,14 +74,14 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Thread_With_Message };
 		co_await NewThreadAwaitable<ThreadData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId + "/threads";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/messages/", dataPackage.messageId, "/threads");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Threads::startThreadWithMessageAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		ThreadData returnData{};
-		Threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Threads::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -89,14 +89,14 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Thread_Without_Message };
 		co_await NewThreadAwaitable<ThreadData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/threads";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/threads");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Threads::startThreadWithoutMessageAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		ThreadData returnData{};
-		Threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Threads::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -104,14 +104,14 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Thread_In_Forum_Channel };
 		co_await NewThreadAwaitable<ThreadData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/threads";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/threads");
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Threads::startThreadInForumChannelAsync()";
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["X-Audit-Log-Reason"] = dataPackage.reason;
 		}
 		ThreadData returnData{};
-		Threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Threads::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -119,9 +119,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Put_Self_In_Thread };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Put;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/thread-members/@me";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/thread-members/@me");
 		workload.callStack = "Threads::joinThreadAsync()";
-		Threads::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Threads::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -129,9 +129,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Put_Thread_Member };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Put;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/thread-members/" + dataPackage.userId;
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/thread-members/", dataPackage.userId);
 		workload.callStack = "Threads::addThreadMemberAsync()";
-		Threads::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Threads::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -139,9 +139,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Self_From_Thread };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/thread-members/@me";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/thread-members/@me");
 		workload.callStack = "Threads::leaveThreadAsync()";
-		Threads::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Threads::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -149,9 +149,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Thread_Member };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/thread-members/" + dataPackage.userId;
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/thread-members/", dataPackage.userId);
 		workload.callStack = "Threads::removeThreadMemberAsync()";
-		Threads::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Threads::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -159,10 +159,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Thread_Member };
 		co_await NewThreadAwaitable<ThreadMemberData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/thread-members/" + dataPackage.userId;
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/thread-members/", dataPackage.userId);
 		workload.callStack = "Threads::getThreadMemberAsync()";
 		ThreadMemberData returnData{};
-		Threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Threads::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -170,10 +170,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Thread_Members };
 		co_await NewThreadAwaitable<Jsonifier::Vector<ThreadMemberData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/thread-members";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/thread-members");
 		workload.callStack = "Threads::getThreadMembersAsync()";
 		Jsonifier::Vector<ThreadMemberData> returnData{};
-		Threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Threads::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -181,10 +181,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Active_Threads };
 		co_await NewThreadAwaitable<ActiveThreadsData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/threads/active";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/threads/active");
 		workload.callStack = "Threads::getActiveThreadsAsync()";
 		ActiveThreadsData returnData{};
-		Threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Threads::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -192,18 +192,18 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Public_Archived_Threads };
 		co_await NewThreadAwaitable<ArchivedThreadsData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/threads/archived/public";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/threads/archived/public");
 		if (dataPackage.before != "") {
-			workload.relativePath += "?before=" + dataPackage.before;
+			workload.appendToRelativePath("?before=", dataPackage.before);
 			if (dataPackage.limit != 0) {
-				workload.relativePath += "&limit=" + std::to_string(dataPackage.limit);
+				workload.appendToRelativePath("&limit=", dataPackage.limit);
 			}
 		} else if (dataPackage.limit != 0) {
-			workload.relativePath += "?limit=" + std::to_string(dataPackage.limit);
+			workload.appendToRelativePath("?limit=", dataPackage.limit);
 		}
 		workload.callStack = "Threads::getPublicArchivedThreadsAsync()";
 		ArchivedThreadsData returnData{};
-		Threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Threads::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -211,18 +211,18 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Private_Archived_Threads };
 		co_await NewThreadAwaitable<ArchivedThreadsData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/threads/archived/protected";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/threads/archived/protected");
 		if (dataPackage.before != "") {
-			workload.relativePath += "?before=" + dataPackage.before;
+			workload.appendToRelativePath("?before=", dataPackage.before);
 			if (dataPackage.limit != 0) {
-				workload.relativePath += "&limit=" + std::to_string(dataPackage.limit);
+				workload.appendToRelativePath("&limit=", dataPackage.limit);
 			}
 		} else if (dataPackage.limit != 0) {
-			workload.relativePath += "?limit=" + std::to_string(dataPackage.limit);
+			workload.appendToRelativePath("?limit=", dataPackage.limit);
 		}
 		workload.callStack = "Threads::getPrivateArchivedThreadsAsync()";
 		ArchivedThreadsData returnData{};
-		Threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Threads::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -230,18 +230,18 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Joined_Private_Archived_Threads };
 		co_await NewThreadAwaitable<ArchivedThreadsData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/users/@me/threads/archived/protected";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/users/@me/threads/archived/protected");
 		if (dataPackage.before != "") {
-			workload.relativePath += "?before=" + dataPackage.before;
+			workload.appendToRelativePath("?before=", dataPackage.before);
 			if (dataPackage.limit != 0) {
-				workload.relativePath += "&limit=" + std::to_string(dataPackage.limit);
+				workload.appendToRelativePath("&limit=", dataPackage.limit);
 			}
 		} else if (dataPackage.limit != 0) {
-			workload.relativePath += "?limit=" + std::to_string(dataPackage.limit);
+			workload.appendToRelativePath("?limit=", dataPackage.limit);
 		}
 		workload.callStack = "Threads::getJoinedPrivateArchivedThreadsAsync()";
 		ArchivedThreadsData returnData{};
-		Threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Threads::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -249,10 +249,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Active_Threads };
 		co_await NewThreadAwaitable<ActiveThreadsData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/threads/active";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/threads/active");
 		workload.callStack = "Threads::listActiveThreadsAsync()";
 		ActiveThreadsData returnData{};
-		Threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Threads::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -276,10 +276,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Put_Recipient_To_Group_Dm };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Put;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/recipients/" + dataPackage.userId;
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/recipients/", dataPackage.userId);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "Users::addRecipientToGroupDMAsync()";
-		Users::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Users::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -287,9 +287,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Recipient_From_Group_Dm };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/recipients/" + dataPackage.userId;
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/recipients/", dataPackage.userId);
 		workload.callStack = "Users::removeRecipientToGroupDMAsync()";
-		Users::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Users::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -297,9 +297,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Current_User_Voice_State };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/voice-states/@me";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/voice-states/@me");
 		workload.callStack = "Users::modifyCurrentUserVoiceStateAsync()";
-		Users::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Users::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -307,9 +307,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_User_Voice_State };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/voice-states/" + dataPackage.userId;
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/voice-states/", dataPackage.userId);
 		workload.callStack = "Users::modifyUserVoiceStateAsync()";
-		Users::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await Users::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -320,7 +320,7 @@ namespace DiscordCoreAPI {
 		workload.relativePath = "/users/@me";
 		workload.callStack = "Users::getCurrentUserAsync()";
 		UserData returnData{};
-		Users::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Users::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		auto newId = returnData.id;
 		insertUser(static_cast<UserCacheData>(returnData));
 		co_return cache[newId];
@@ -340,13 +340,13 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_User };
 		co_await NewThreadAwaitable<UserData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/users/" + dataPackage.userId;
+		workload.setRelativePath("/users/", dataPackage.userId);
 		workload.callStack = "Users::getUserAsync()";
 		UserData data{ dataPackage.userId };
 		if (cache.contains(data.id)) {
 			data = cache[data.id];
 		}
-		Users::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		co_await Users::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), data);
 		if (doWeCacheUsersBool) {
 			insertUser(static_cast<UserCacheData>(data));
 		}
@@ -361,7 +361,7 @@ namespace DiscordCoreAPI {
 		workload.callStack = "Users::modifyCurrentUserAsync()";
 		parser.serializeJson(dataPackage, workload.content);
 		UserData returnData{};
-		Users::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Users::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -372,7 +372,7 @@ namespace DiscordCoreAPI {
 		workload.relativePath = "/users/@me/connections";
 		workload.callStack = "Users::getUserConnectionsAsync()";
 		Jsonifier::Vector<ConnectionData> returnData{};
-		Users::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Users::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -383,7 +383,7 @@ namespace DiscordCoreAPI {
 		workload.relativePath = "/oauth2/applications/@me";
 		workload.callStack = "Users::getApplicationDataAsync()";
 		ApplicationData returnData{};
-		Users::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Users::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -394,7 +394,7 @@ namespace DiscordCoreAPI {
 		workload.relativePath = "/oauth2/@me";
 		workload.callStack = "Users::getCurrentUserAuthorizationInfoAsync()";
 		AuthorizationInfoData returnData{};
-		Users::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await Users::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -171,6 +171,34 @@ namespace DiscordCoreAPI {
 		return config.intents;
 	}
 
+	uint32_t ConfigManager::getAudioBufferDepthInMs() const {
+		return config.audioOptions.bufferDepthInMs;
+	}
+
+	uint32_t ConfigManager::getAudioPrefetchAfterInMs() const {
+		return config.audioOptions.prefetchAfterInMs;
+	}
+
+	uint64_t ConfigManager::getAudioCacheSizeBudget() const {
+		return config.audioOptions.cacheSizeBudgetInBytes;
+	}
+
+	std::string ConfigManager::getAudioCacheDirectory() const {
+		return config.audioOptions.cacheDirectory;
+	}
+
+	bool ConfigManager::doWeBulkOverwriteCommands() const {
+		return config.commandOptions.bulkOverwrite;
+	}
+
+	std::string ConfigManager::getCommandStateFilePath() const {
+		return config.commandOptions.stateFilePath;
+	}
+
+	UnorderedMap<DiscordCoreInternal::HttpsWorkloadType, uint32_t> ConfigManager::getResponseCacheTtls() const {
+		return config.restOptions.responseCacheTtlsInMs;
+	}
+
 	AudioFrameData::AudioFrameData(AudioFrameType frameTypeNew) {
 		type = frameTypeNew;
 	}
@@ -192,10 +192,14 @@ namespace DiscordCoreAPI {
 			return;
 		}
 		if (buffer.size() > 0) {
-			AudioFrameData frame{};
-			frame += buffer;
-			frame.type = AudioFrameType::RawPCM;
-			discordCoreClient->getSongAPI(guildId).audioDataBuffer.send(std::move(frame));
+			outgoingFrame.clearData();
+			outgoingFrame += buffer;
+			outgoingFrame.type = AudioFrameType::RawPCM;
+			if (!discordCoreClient->getSongAPI(guildId).getActiveBuffer().trySend(outgoingFrame) && droppedFrameCount++ % 500 == 0) {
+				MessagePrinter::printError<PrintMessageType::WebSocket>(
+					"VoiceConnectionBridge::parseOutgoingVoiceData() Error: The audio buffer is full, " + std::to_string(droppedFrameCount) +
+					" frame(s) dropped so far.");
+			}
 		}
 	}
 
@@ -356,12 +360,12 @@ namespace DiscordCoreAPI {
 		}
 	}
 
-	UnboundedMessageBlock<AudioFrameData>& VoiceConnection::getAudioBuffer() {
-		return discordCoreClient->getSongAPI(voiceConnectInitData.guildId).audioDataBuffer;
+	BoundedMessageBlock<AudioFrameData>& VoiceConnection::getAudioBuffer() {
+		return discordCoreClient->getSongAPI(voiceConnectInitData.guildId).getActiveBuffer();
 	}
 
 	void VoiceConnection::checkForAndSendHeartBeat(const bool isImmedate) {
-		if (heartBeatStopWatch.hasTimePassed() || isImmedate) {
+		if (isHeartBeatDue->exchange(false) || isImmedate) {
 			DiscordCoreInternal::WebSocketMessageData<uint32_t> message{};
 			message.excludedKeys.emplace("t");
 			message.excludedKeys.emplace("s");
@@ -457,7 +461,7 @@ namespace DiscordCoreAPI {
 				DiscordCoreInternal::WebSocketMessageData<VoiceConnectionHelloData> dataNew{};
 				parser.parseJson<true, true>(dataNew, data);
 				heartBeatStopWatch = StopWatch<Milliseconds>{ Milliseconds{ static_cast<uint32_t>(dataNew.d.heartBeatInterval) } };
-				areWeHeartBeating = true;
+				startHeartBeating(Milliseconds{ static_cast<uint32_t>(dataNew.d.heartBeatInterval) });
 				connectionState.store(VoiceConnectionState::Sending_Identify);
 				currentState = DiscordCoreInternal::WebSocketState::Authenticated;
 				haveWeReceivedHeartbeatAck = true;
@@ -505,14 +509,14 @@ namespace DiscordCoreAPI {
 			streamSocket->inputBuffer.clear();
 			streamSocket->outputBuffer.clear();
 		}
-		areWeHeartBeating = false;
+		stopHeartBeating();
 		switch (connectionState.load()) {
 			case VoiceConnectionState::Collecting_Init_Data: {
 				baseShard->voiceConnectionDataBufferMap[voiceConnectInitData.guildId.operator const uint64_t&()] = &voiceConnectionDataBuffer;
 				baseShard->voiceConnectionDataBufferMap[voiceConnectInitData.guildId.operator const uint64_t&()]->clearContents();
 				baseShard->getVoiceConnectionData(voiceConnectInitData);
 
-				if (waitForTimeToPass(voiceConnectionDataBuffer, voiceConnectionData, 10000)) {
+				if (!voiceConnectionDataBuffer.receiveFor(voiceConnectionData, 10000ms)) {
 					++currentReconnectTries;
 					onClosed();
 					return;
@@ -750,9 +754,20 @@ namespace DiscordCoreAPI {
 							if (!token.promise().areWeStopped() && VoiceConnection::areWeConnected()) {
 								checkForAndSendHeartBeat(false);
 							}
-							discordCoreClient->getSongAPI(voiceConnectInitData.guildId).audioDataBuffer.tryReceive(xferAudioData);
+							auto& songAPI = discordCoreClient->getSongAPI(voiceConnectInitData.guildId);
+							if (songAPI.getActiveBuffer().tryReceive(xferAudioData) && xferAudioData.currentSize > 0) {
+								songAPI.onFramePlayed();
+							}
 							if ((doWeSkip.load() && xferAudioData.currentSize == 0)) {
-								skipInternal();
+								bool wasItHandedOff{ xferAudioData.guildMemberId != 0 && songAPI.handOffToNextSong() };
+								if (wasItHandedOff && !songAPI.onSongCompletionEvent.hasListeners()) {
+									xferAudioData.clearData();
+								} else {
+									skipInternal();
+								}
+								if (wasItHandedOff) {
+									songAPI.onHandOffComplete();
+								}
 							}
 
 							AudioFrameType frameType{ xferAudioData.type };
@@ -882,7 +897,7 @@ namespace DiscordCoreAPI {
 		}
 		try {
 			xferAudioData.clearData();
-			if (discordCoreClient->getSongAPI(voiceConnectInitData.guildId).onSongCompletionEvent.functions.size() > 0) {
+			if (discordCoreClient->getSongAPI(voiceConnectInitData.guildId).onSongCompletionEvent.hasListeners()) {
 				discordCoreClient->getSongAPI(voiceConnectInitData.guildId).onSongCompletionEvent(completionEventData);
 			} else {
 				stop();
@@ -1008,14 +1023,13 @@ namespace DiscordCoreAPI {
 		};
 		udpConnection.disconnect();
 		WebSocketCore::disconnect();
-		areWeHeartBeating = false;
 		currentReconnectTries = 0;
 		voiceUsers.clear();
 		prevActiveState.store(VoiceActiveState::Stopped);
 		activeState.store(VoiceActiveState::Connecting);
 		connectionState.store(VoiceConnectionState::Collecting_Init_Data);
 		currentState.store(DiscordCoreInternal::WebSocketState::Disconnected);
-		discordCoreClient->getSongAPI(voiceConnectInitData.guildId).audioDataBuffer.clearContents();
+		discordCoreClient->getSongAPI(voiceConnectInitData.guildId).getActiveBuffer().clearContents();
 	}
 
 	void VoiceConnection::onClosed() {
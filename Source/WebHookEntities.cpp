@@ -204,11 +204,11 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Webhook };
 		co_await NewThreadAwaitable<WebHookData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/webhooks";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/webhooks");
 		workload.callStack = "WebHooks::createWebHookDataAsync()";
 		parser.serializeJson(dataPackage, workload.content);
 		WebHookData returnData{};
-		WebHooks::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await WebHooks::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -216,10 +216,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Channel_Webhooks };
 		co_await NewThreadAwaitable<Jsonifier::Vector<WebHookData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/channels/" + dataPackage.channelId + "/webhooks";
+		workload.setRelativePath("/channels/", dataPackage.channelId, "/webhooks");
 		workload.callStack = "WebHooks::getChannelWebHooksAsync()";
 		Jsonifier::Vector<WebHookData> returnData{};
-		WebHooks::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await WebHooks::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -227,10 +227,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Webhooks };
 		co_await NewThreadAwaitable<Jsonifier::Vector<WebHookData>>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/guilds/" + dataPackage.guildId + "/webhooks";
+		workload.setRelativePath("/guilds/", dataPackage.guildId, "/webhooks");
 		workload.callStack = "WebHooks::getGuildWebHooksAsync()";
 		Jsonifier::Vector<WebHookData> returnData{};
-		WebHooks::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await WebHooks::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -238,10 +238,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Webhook };
 		co_await NewThreadAwaitable<WebHookData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/webhooks/" + dataPackage.webHookId;
+		workload.setRelativePath("/webhooks/", dataPackage.webHookId);
 		workload.callStack = "WebHooks::getWebHookDataAsync()";
 		WebHookData returnData{};
-		WebHooks::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await WebHooks::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -249,10 +249,10 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Webhook_With_Token };
 		co_await NewThreadAwaitable<WebHookData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/webhooks/" + dataPackage.webHookId + "/" + dataPackage.webhookToken;
+		workload.setRelativePath("/webhooks/", dataPackage.webHookId, "/", dataPackage.webhookToken);
 		workload.callStack = "WebHooks::getWebHookDataWithTokenAsync()";
 		WebHookData returnData{};
-		WebHooks::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await WebHooks::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -260,11 +260,11 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Webhook };
 		co_await NewThreadAwaitable<WebHookData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/webhooks/" + dataPackage.webHookId;
+		workload.setRelativePath("/webhooks/", dataPackage.webHookId);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "WebHooks::modifyWebHookDataAsync()";
 		WebHookData returnData{};
-		WebHooks::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await WebHooks::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -272,11 +272,11 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Webhook_With_Token };
 		co_await NewThreadAwaitable<WebHookData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/webhooks/" + dataPackage.webHookId + "/" + dataPackage.webhookToken;
+		workload.setRelativePath("/webhooks/", dataPackage.webHookId, "/", dataPackage.webhookToken);
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "WebHooks::modifyWebHookDataWithTokenAsync()";
 		WebHookData returnData{};
-		WebHooks::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await WebHooks::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -284,9 +284,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Webhook };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/webhooks/" + dataPackage.webHookId;
+		workload.setRelativePath("/webhooks/", dataPackage.webHookId);
 		workload.callStack = "WebHooks::deleteWebHookDataAsync()";
-		WebHooks::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await WebHooks::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -294,9 +294,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Webhook_With_Token };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/webhooks/" + dataPackage.webHookId + "/" + dataPackage.webhookToken;
+		workload.setRelativePath("/webhooks/", dataPackage.webHookId, "/", dataPackage.webhookToken);
 		workload.callStack = "WebHooks::deleteWebHookDataWithTokenAsync()";
-		WebHooks::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await WebHooks::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -304,16 +304,16 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Post_Execute_Webhook };
 		co_await NewThreadAwaitable<MessageData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Post;
-		workload.relativePath = "/webhooks/" + dataPackage.webHookId + "/" + dataPackage.webhookToken;
+		workload.setRelativePath("/webhooks/", dataPackage.webHookId, "/", dataPackage.webhookToken);
 		workload.callStack = "WebHooks::executeWebHookDataAsync()";
 		if (dataPackage.wait) {
 			workload.relativePath += "?wait=true";
 			if (dataPackage.threadId != 0) {
-				workload.relativePath += "&thread_id=" + dataPackage.threadId;
+				workload.appendToRelativePath("&thread_id=", dataPackage.threadId);
 			}
 		}
 		if (dataPackage.threadId != 0) {
-			workload.relativePath += "?thread_id=" + dataPackage.threadId;
+			workload.appendToRelativePath("?thread_id=", dataPackage.threadId);
 		}
 		if (dataPackage.files.size() > 0) {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
@@ -323,7 +323,7 @@ namespace DiscordCoreAPI {
 			parser.serializeJson(dataPackage, workload.content);
 		}
 		MessageData returnData{};
-		WebHooks::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await WebHooks::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -331,13 +331,13 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Webhook_Message };
 		co_await NewThreadAwaitable<MessageData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Get;
-		workload.relativePath = "/webhooks/" + dataPackage.webHookId + "/" + dataPackage.webhookToken + "/messages/" + dataPackage.messageId;
+		workload.setRelativePath("/webhooks/", dataPackage.webHookId, "/", dataPackage.webhookToken, "/messages/", dataPackage.messageId);
 		if (dataPackage.threadId != 0) {
-			workload.relativePath += "?thread_id=" + dataPackage.threadId;
+			workload.appendToRelativePath("?thread_id=", dataPackage.threadId);
 		}
 		workload.callStack = "WebHooks::getWebHookDataMessageAsync()";
 		MessageData returnData{};
-		WebHooks::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await WebHooks::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -345,9 +345,9 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Webhook_Message };
 		co_await NewThreadAwaitable<MessageData>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Patch;
-		workload.relativePath = "/webhooks/" + dataPackage.webHookId + "/" + dataPackage.webhookToken + "/messages/" + dataPackage.messageId;
+		workload.setRelativePath("/webhooks/", dataPackage.webHookId, "/", dataPackage.webhookToken, "/messages/", dataPackage.messageId);
 		if (dataPackage.threadId != 0) {
-			workload.relativePath += "?thread_id=" + dataPackage.threadId;
+			workload.appendToRelativePath("?thread_id=", dataPackage.threadId);
 		}
 		if (dataPackage.files.size() > 0) {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
@@ -358,7 +358,7 @@ namespace DiscordCoreAPI {
 		}
 		workload.callStack = "WebHooks::editWebHookDataMessageAsync()";
 		MessageData returnData{};
-		WebHooks::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await WebHooks::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -366,12 +366,12 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_Webhook_Message };
 		co_await NewThreadAwaitable<void>();
 		workload.workloadClass = DiscordCoreInternal::HttpsWorkloadClass::Delete;
-		workload.relativePath = "/webhooks/" + dataPackage.webHookId + "/" + dataPackage.webhookToken + "/messages/" + dataPackage.messageId;
+		workload.setRelativePath("/webhooks/", dataPackage.webHookId, "/", dataPackage.webhookToken, "/messages/", dataPackage.messageId);
 		if (dataPackage.threadId != 0) {
-			workload.relativePath += "?thread_id=" + dataPackage.threadId;
+			workload.appendToRelativePath("?thread_id=", dataPackage.threadId);
 		}
 		workload.callStack = "WebHooks::deleteWebHookDataMessageAsync()";
-		WebHooks::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await WebHooks::httpsClient->submitWorkloadAndGetResultAsync(std::move(workload));
 		co_return;
 	}
 
@@ -188,6 +188,9 @@ namespace DiscordCoreAPI {
 			haveWeReceivedHeartbeatAck = other.haveWeReceivedHeartbeatAck;
 			areWeCollectingData.store(other.areWeCollectingData.load());
 			heartBeatStopWatch = std::move(other.heartBeatStopWatch);
+			stopHeartBeating();
+			std::swap(isHeartBeatDue, other.isHeartBeatDue);
+			heartBeatTimerId = std::exchange(other.heartBeatTimerId, 0);
 			currentReconnectTries = other.currentReconnectTries;
 			currentMessage = std::move(other.currentMessage);
 			tcpConnection = std::move(other.tcpConnection);
@@ -304,8 +307,28 @@ namespace DiscordCoreAPI {
 			}
 		}
 
+		void WebSocketCore::startHeartBeating(Milliseconds heartBeatInterval) {
+			stopHeartBeating();
+			isHeartBeatDue->store(false);
+			heartBeatTimerId = DiscordCoreAPI::NewThreadAwaiterBase::timerWheel.schedule(
+				heartBeatInterval,
+				[isHeartBeatDueNew = isHeartBeatDue]() {
+					isHeartBeatDueNew->store(true);
+				},
+				heartBeatInterval);
+			areWeHeartBeating = true;
+		}
+
+		void WebSocketCore::stopHeartBeating() {
+			if (heartBeatTimerId != 0) {
+				DiscordCoreAPI::NewThreadAwaiterBase::timerWheel.cancel(heartBeatTimerId);
+				heartBeatTimerId = 0;
+			}
+			areWeHeartBeating = false;
+		}
+
 		bool WebSocketCore::checkForAndSendHeartBeat(bool isImmediate) {
-			if ((currentState.load() == WebSocketState::Authenticated && heartBeatStopWatch.hasTimePassed() && haveWeReceivedHeartbeatAck) ||
+			if ((currentState.load() == WebSocketState::Authenticated && haveWeReceivedHeartbeatAck && isHeartBeatDue->exchange(false)) ||
 				isImmediate) {
 				std::string string{};
 				if (dataOpCode == WebSocketOpCode::Op_Binary) {
@@ -557,7 +580,7 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 3: {
-										if (discordCoreClient->eventManager.onApplicationCommandPermissionsUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onApplicationCommandPermissionsUpdateEvent.hasListeners()) {
 											UniquePtr<OnApplicationCommandPermissionsUpdateData> dataPackage{
 												makeUnique<OnApplicationCommandPermissionsUpdateData>(parser, dataNew)
 											};
@@ -566,7 +589,7 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 4: {
-										if (discordCoreClient->eventManager.onAutoModerationRuleCreationEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onAutoModerationRuleCreationEvent.hasListeners()) {
 											UniquePtr<OnAutoModerationRuleCreationData> dataPackage{ makeUnique<OnAutoModerationRuleCreationData>(
 												parser, dataNew) };
 											discordCoreClient->eventManager.onAutoModerationRuleCreationEvent(*dataPackage);
@@ -574,7 +597,7 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 5: {
-										if (discordCoreClient->eventManager.onAutoModerationRuleUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onAutoModerationRuleUpdateEvent.hasListeners()) {
 											UniquePtr<OnAutoModerationRuleUpdateData> dataPackage{ makeUnique<OnAutoModerationRuleUpdateData>(parser,
 												dataNew) };
 											discordCoreClient->eventManager.onAutoModerationRuleUpdateEvent(*dataPackage);
@@ -582,7 +605,7 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 6: {
-										if (discordCoreClient->eventManager.onAutoModerationRuleDeletionEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onAutoModerationRuleDeletionEvent.hasListeners()) {
 											UniquePtr<OnAutoModerationRuleDeletionData> dataPackage{ makeUnique<OnAutoModerationRuleDeletionData>(
 												parser, dataNew) };
 											discordCoreClient->eventManager.onAutoModerationRuleDeletionEvent(*dataPackage);
@@ -590,7 +613,7 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 7: {
-										if (discordCoreClient->eventManager.onAutoModerationActionExecutionEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onAutoModerationActionExecutionEvent.hasListeners()) {
 											UniquePtr<OnAutoModerationActionExecutionData> dataPackage{
 												makeUnique<OnAutoModerationActionExecutionData>(parser, dataNew)
 											};
@@ -599,70 +622,76 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 8: {
-										UniquePtr<OnChannelCreationData> dataPackage{ makeUnique<OnChannelCreationData>(parser, dataNew) };
-										if (discordCoreClient->eventManager.onChannelCreationEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onChannelCreationEvent.hasListeners()) {
+											UniquePtr<OnChannelCreationData> dataPackage{ makeUnique<OnChannelCreationData>(parser, dataNew) };
 											discordCoreClient->eventManager.onChannelCreationEvent(*dataPackage);
+										} else if (Channels::doWeCacheChannels()) {
+											OnChannelCreationData::updateCache(parser, dataNew);
 										}
 										break;
 									}
 									case 9: {
-										UniquePtr<OnChannelUpdateData> dataPackage{ makeUnique<OnChannelUpdateData>(parser, dataNew) };
-										if (discordCoreClient->eventManager.onChannelUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onChannelUpdateEvent.hasListeners()) {
+											UniquePtr<OnChannelUpdateData> dataPackage{ makeUnique<OnChannelUpdateData>(parser, dataNew) };
 											discordCoreClient->eventManager.onChannelUpdateEvent(*dataPackage);
+										} else if (Channels::doWeCacheChannels()) {
+											OnChannelUpdateData::updateCache(parser, dataNew);
 										}
 										break;
 									}
 									case 10: {
-										UniquePtr<OnChannelDeletionData> dataPackage{ makeUnique<OnChannelDeletionData>(parser, dataNew) };
-										if (discordCoreClient->eventManager.onChannelDeletionEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onChannelDeletionEvent.hasListeners()) {
+											UniquePtr<OnChannelDeletionData> dataPackage{ makeUnique<OnChannelDeletionData>(parser, dataNew) };
 											discordCoreClient->eventManager.onChannelDeletionEvent(*dataPackage);
+										} else if (Channels::doWeCacheChannels()) {
+											OnChannelDeletionData::updateCache(parser, dataNew);
 										}
 										break;
 									}
 									case 11: {
-										if (discordCoreClient->eventManager.onChannelPinsUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onChannelPinsUpdateEvent.hasListeners()) {
 											UniquePtr<OnChannelPinsUpdateData> dataPackage{ makeUnique<OnChannelPinsUpdateData>(parser, dataNew) };
 											discordCoreClient->eventManager.onChannelPinsUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 12: {
-										if (discordCoreClient->eventManager.onThreadCreationEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onThreadCreationEvent.hasListeners()) {
 											UniquePtr<OnThreadCreationData> dataPackage{ makeUnique<OnThreadCreationData>(parser, dataNew) };
 											discordCoreClient->eventManager.onThreadCreationEvent(*dataPackage);
 										}
 										break;
 									}
 									case 13: {
-										if (discordCoreClient->eventManager.onThreadUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onThreadUpdateEvent.hasListeners()) {
 											UniquePtr<OnThreadUpdateData> dataPackage{ makeUnique<OnThreadUpdateData>(parser, dataNew) };
 											discordCoreClient->eventManager.onThreadUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 14: {
-										if (discordCoreClient->eventManager.onThreadDeletionEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onThreadDeletionEvent.hasListeners()) {
 											UniquePtr<OnThreadDeletionData> dataPackage{ makeUnique<OnThreadDeletionData>(parser, dataNew) };
 											discordCoreClient->eventManager.onThreadDeletionEvent(*dataPackage);
 										}
 										break;
 									}
 									case 15: {
-										if (discordCoreClient->eventManager.onThreadListSyncEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onThreadListSyncEvent.hasListeners()) {
 											UniquePtr<OnThreadListSyncData> dataPackage{ makeUnique<OnThreadListSyncData>(parser, dataNew) };
 											discordCoreClient->eventManager.onThreadListSyncEvent(*dataPackage);
 										}
 										break;
 									}
 									case 16: {
-										if (discordCoreClient->eventManager.onThreadMemberUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onThreadMemberUpdateEvent.hasListeners()) {
 											UniquePtr<OnThreadMemberUpdateData> dataPackage{ makeUnique<OnThreadMemberUpdateData>(parser, dataNew) };
 											discordCoreClient->eventManager.onThreadMemberUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 17: {
-										if (discordCoreClient->eventManager.onThreadMembersUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onThreadMembersUpdateEvent.hasListeners()) {
 											UniquePtr<OnThreadMembersUpdateData> dataPackage{ makeUnique<OnThreadMembersUpdateData>(parser,
 												dataNew) };
 											discordCoreClient->eventManager.onThreadMembersUpdateEvent(*dataPackage);
@@ -670,50 +699,63 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 18: {
-										UniquePtr<OnGuildCreationData> dataPackage{ makeUnique<OnGuildCreationData>(parser, dataNew,
-											discordCoreClient) };
-										if (discordCoreClient->eventManager.onGuildCreationEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildCreationEvent.hasListeners()) {
+											UniquePtr<OnGuildCreationData> dataPackage{ makeUnique<OnGuildCreationData>(parser, dataNew,
+												discordCoreClient) };
 											discordCoreClient->eventManager.onGuildCreationEvent(*dataPackage);
+										} else if (Guilds::doWeCacheGuilds() || Channels::doWeCacheChannels() || Roles::doWeCacheRoles() ||
+											GuildMembers::doWeCacheGuildMembers()) {
+											OnGuildCreationData::updateCache(parser, dataNew, discordCoreClient);
 										}
 										break;
 									}
 									case 19: {
-										UniquePtr<OnGuildUpdateData> dataPackage{ makeUnique<OnGuildUpdateData>(parser, dataNew, discordCoreClient) };
-										if (discordCoreClient->eventManager.onGuildUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildUpdateEvent.hasListeners()) {
+											UniquePtr<OnGuildUpdateData> dataPackage{ makeUnique<OnGuildUpdateData>(parser, dataNew,
+												discordCoreClient) };
 											discordCoreClient->eventManager.onGuildUpdateEvent(*dataPackage);
+										} else if (Guilds::doWeCacheGuilds()) {
+											OnGuildUpdateData::updateCache(parser, dataNew, discordCoreClient);
 										}
 										break;
 									}
 									case 20: {
-										UniquePtr<OnGuildDeletionData> dataPackage{ makeUnique<OnGuildDeletionData>(parser, dataNew) };
-										if (discordCoreClient->eventManager.onGuildDeletionEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildDeletionEvent.hasListeners()) {
+											UniquePtr<OnGuildDeletionData> dataPackage{ makeUnique<OnGuildDeletionData>(parser, dataNew) };
 											discordCoreClient->eventManager.onGuildDeletionEvent(*dataPackage);
+										} else if (Guilds::doWeCacheGuilds() || Channels::doWeCacheChannels() || Roles::doWeCacheRoles() ||
+											GuildMembers::doWeCacheGuildMembers()) {
+											OnGuildDeletionData::updateCache(parser, dataNew);
 										}
 										break;
 									}
 									case 21: {
-										if (discordCoreClient->eventManager.onGuildBanAddEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildBanAddEvent.hasListeners()) {
 											UniquePtr<OnGuildBanAddData> dataPackage{ makeUnique<OnGuildBanAddData>(parser, dataNew) };
 											discordCoreClient->eventManager.onGuildBanAddEvent(*dataPackage);
+										} else if (Guilds::doWeCacheGuilds()) {
+											OnGuildBanAddData::updateCache(parser, dataNew);
 										}
 										break;
 									}
 									case 22: {
-										if (discordCoreClient->eventManager.onGuildBanRemoveEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildBanRemoveEvent.hasListeners()) {
 											UniquePtr<OnGuildBanRemoveData> dataPackage{ makeUnique<OnGuildBanRemoveData>(parser, dataNew) };
 											discordCoreClient->eventManager.onGuildBanRemoveEvent(*dataPackage);
 										}
 										break;
 									}
 									case 23: {
-										if (discordCoreClient->eventManager.onGuildEmojisUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildEmojisUpdateEvent.hasListeners()) {
 											UniquePtr<OnGuildEmojisUpdateData> dataPackage{ makeUnique<OnGuildEmojisUpdateData>(parser, dataNew) };
 											discordCoreClient->eventManager.onGuildEmojisUpdateEvent(*dataPackage);
+										} else if (Guilds::doWeCacheGuilds()) {
+											OnGuildEmojisUpdateData::updateCache(parser, dataNew);
 										}
 										break;
 									}
 									case 24: {
-										if (discordCoreClient->eventManager.onGuildStickersUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildStickersUpdateEvent.hasListeners()) {
 											UniquePtr<OnGuildStickersUpdateData> dataPackage{ makeUnique<OnGuildStickersUpdateData>(parser,
 												dataNew) };
 											discordCoreClient->eventManager.onGuildStickersUpdateEvent(*dataPackage);
@@ -721,7 +763,7 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 25: {
-										if (discordCoreClient->eventManager.onGuildIntegrationsUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildIntegrationsUpdateEvent.hasListeners()) {
 											UniquePtr<OnGuildIntegrationsUpdateData> dataPackage{ makeUnique<OnGuildIntegrationsUpdateData>(parser,
 												dataNew) };
 											discordCoreClient->eventManager.onGuildIntegrationsUpdateEvent(*dataPackage);
@@ -729,56 +771,68 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 26: {
-										UniquePtr<OnGuildMemberAddData> dataPackage{ makeUnique<OnGuildMemberAddData>(parser, dataNew) };
-										if (discordCoreClient->eventManager.onGuildMemberAddEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildMemberAddEvent.hasListeners()) {
+											UniquePtr<OnGuildMemberAddData> dataPackage{ makeUnique<OnGuildMemberAddData>(parser, dataNew) };
 											discordCoreClient->eventManager.onGuildMemberAddEvent(*dataPackage);
+										} else if (GuildMembers::doWeCacheGuildMembers()) {
+											OnGuildMemberAddData::updateCache(parser, dataNew);
 										}
 										break;
 									}
 									case 27: {
-										UniquePtr<OnGuildMemberRemoveData> dataPackage{ makeUnique<OnGuildMemberRemoveData>(parser, dataNew) };
-										if (discordCoreClient->eventManager.onGuildMemberRemoveEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildMemberRemoveEvent.hasListeners()) {
+											UniquePtr<OnGuildMemberRemoveData> dataPackage{ makeUnique<OnGuildMemberRemoveData>(parser, dataNew) };
 											discordCoreClient->eventManager.onGuildMemberRemoveEvent(*dataPackage);
+										} else if (GuildMembers::doWeCacheGuildMembers()) {
+											OnGuildMemberRemoveData::updateCache(parser, dataNew);
 										}
 										break;
 									}
 									case 28: {
-										UniquePtr<OnGuildMemberUpdateData> dataPackage{ makeUnique<OnGuildMemberUpdateData>(parser, dataNew) };
-										if (discordCoreClient->eventManager.onGuildMemberUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildMemberUpdateEvent.hasListeners()) {
+											UniquePtr<OnGuildMemberUpdateData> dataPackage{ makeUnique<OnGuildMemberUpdateData>(parser, dataNew) };
 											discordCoreClient->eventManager.onGuildMemberUpdateEvent(*dataPackage);
+										} else if (GuildMembers::doWeCacheGuildMembers()) {
+											OnGuildMemberUpdateData::updateCache(parser, dataNew);
 										}
 										break;
 									}
 									case 29: {
-										if (discordCoreClient->eventManager.onGuildMembersChunkEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildMembersChunkEvent.hasListeners()) {
 											UniquePtr<OnGuildMembersChunkData> dataPackage{ makeUnique<OnGuildMembersChunkData>(parser, dataNew) };
 											discordCoreClient->eventManager.onGuildMembersChunkEvent(*dataPackage);
 										}
 										break;
 									}
 									case 30: {
-										UniquePtr<OnRoleCreationData> dataPackage{ makeUnique<OnRoleCreationData>(parser, dataNew) };
-										if (discordCoreClient->eventManager.onRoleCreationEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onRoleCreationEvent.hasListeners()) {
+											UniquePtr<OnRoleCreationData> dataPackage{ makeUnique<OnRoleCreationData>(parser, dataNew) };
 											discordCoreClient->eventManager.onRoleCreationEvent(*dataPackage);
+										} else if (Roles::doWeCacheRoles()) {
+											OnRoleCreationData::updateCache(parser, dataNew);
 										}
 										break;
 									}
 									case 31: {
-										UniquePtr<OnRoleUpdateData> dataPackage{ makeUnique<OnRoleUpdateData>(parser, dataNew) };
-										if (discordCoreClient->eventManager.onRoleUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onRoleUpdateEvent.hasListeners()) {
+											UniquePtr<OnRoleUpdateData> dataPackage{ makeUnique<OnRoleUpdateData>(parser, dataNew) };
 											discordCoreClient->eventManager.onRoleUpdateEvent(*dataPackage);
+										} else if (Roles::doWeCacheRoles()) {
+											OnRoleUpdateData::updateCache(parser, dataNew);
 										}
 										break;
 									}
 									case 32: {
-										UniquePtr<OnRoleDeletionData> dataPackage{ makeUnique<OnRoleDeletionData>(parser, dataNew) };
-										if (discordCoreClient->eventManager.onRoleDeletionEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onRoleDeletionEvent.hasListeners()) {
+											UniquePtr<OnRoleDeletionData> dataPackage{ makeUnique<OnRoleDeletionData>(parser, dataNew) };
 											discordCoreClient->eventManager.onRoleDeletionEvent(*dataPackage);
+										} else if (Roles::doWeCacheRoles()) {
+											OnRoleDeletionData::updateCache(parser, dataNew);
 										}
 										break;
 									}
 									case 33: {
-										if (discordCoreClient->eventManager.onGuildScheduledEventCreationEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildScheduledEventCreationEvent.hasListeners()) {
 											UniquePtr<OnGuildScheduledEventCreationData> dataPackage{ makeUnique<OnGuildScheduledEventCreationData>(
 												parser, dataNew) };
 											discordCoreClient->eventManager.onGuildScheduledEventCreationEvent(*dataPackage);
@@ -786,7 +840,7 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 34: {
-										if (discordCoreClient->eventManager.onGuildScheduledEventUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildScheduledEventUpdateEvent.hasListeners()) {
 											UniquePtr<OnGuildScheduledEventUpdateData> dataPackage{ makeUnique<OnGuildScheduledEventUpdateData>(
 												parser, dataNew) };
 											discordCoreClient->eventManager.onGuildScheduledEventUpdateEvent(*dataPackage);
@@ -794,7 +848,7 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 35: {
-										if (discordCoreClient->eventManager.onGuildScheduledEventDeletionEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildScheduledEventDeletionEvent.hasListeners()) {
 											UniquePtr<OnGuildScheduledEventDeletionData> dataPackage{ makeUnique<OnGuildScheduledEventDeletionData>(
 												parser, dataNew) };
 											discordCoreClient->eventManager.onGuildScheduledEventDeletionEvent(*dataPackage);
@@ -802,7 +856,7 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 36: {
-										if (discordCoreClient->eventManager.onGuildScheduledEventUserAddEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildScheduledEventUserAddEvent.hasListeners()) {
 											UniquePtr<OnGuildScheduledEventUserAddData> dataPackage{ makeUnique<OnGuildScheduledEventUserAddData>(
 												parser, dataNew) };
 											discordCoreClient->eventManager.onGuildScheduledEventUserAddEvent(*dataPackage);
@@ -810,7 +864,7 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 37: {
-										if (discordCoreClient->eventManager.onGuildScheduledEventUserRemoveEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onGuildScheduledEventUserRemoveEvent.hasListeners()) {
 											UniquePtr<OnGuildScheduledEventUserRemoveData> dataPackage{
 												makeUnique<OnGuildScheduledEventUserRemoveData>(parser, dataNew)
 											};
@@ -819,7 +873,7 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 38: {
-										if (discordCoreClient->eventManager.onIntegrationCreationEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onIntegrationCreationEvent.hasListeners()) {
 											UniquePtr<OnIntegrationCreationData> dataPackage{ makeUnique<OnIntegrationCreationData>(parser,
 												dataNew) };
 											discordCoreClient->eventManager.onIntegrationCreationEvent(*dataPackage);
@@ -827,14 +881,14 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 39: {
-										if (discordCoreClient->eventManager.onIntegrationUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onIntegrationUpdateEvent.hasListeners()) {
 											UniquePtr<OnIntegrationUpdateData> dataPackage{ makeUnique<OnIntegrationUpdateData>(parser, dataNew) };
 											discordCoreClient->eventManager.onIntegrationUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 40: {
-										if (discordCoreClient->eventManager.onIntegrationDeletionEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onIntegrationDeletionEvent.hasListeners()) {
 											UniquePtr<OnIntegrationDeletionData> dataPackage{ makeUnique<OnIntegrationDeletionData>(parser,
 												dataNew) };
 											discordCoreClient->eventManager.onIntegrationDeletionEvent(*dataPackage);
@@ -844,76 +898,82 @@ namespace DiscordCoreAPI {
 									case 41: {
 										UniquePtr<OnInteractionCreationData> dataPackage{ makeUnique<OnInteractionCreationData>(parser, dataNew,
 											discordCoreClient) };
-										if (discordCoreClient->eventManager.onInteractionCreationEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onInteractionCreationEvent.hasListeners()) {
 											discordCoreClient->eventManager.onInteractionCreationEvent(*dataPackage);
 										}
 										break;
 									}
 									case 42: {
-										if (discordCoreClient->eventManager.onInviteCreationEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onInviteCreationEvent.hasListeners()) {
 											UniquePtr<OnInviteCreationData> dataPackage{ makeUnique<OnInviteCreationData>(parser, dataNew) };
 											discordCoreClient->eventManager.onInviteCreationEvent(*dataPackage);
 										}
 										break;
 									}
 									case 43: {
-										if (discordCoreClient->eventManager.onInviteDeletionEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onInviteDeletionEvent.hasListeners()) {
 											UniquePtr<OnInviteDeletionData> dataPackage{ makeUnique<OnInviteDeletionData>(parser, dataNew) };
 											discordCoreClient->eventManager.onInviteDeletionEvent(*dataPackage);
 										}
 										break;
 									}
 									case 44: {
-										UniquePtr<OnMessageCreationData> dataPackage{ makeUnique<OnMessageCreationData>(parser, dataNew) };
-										if (discordCoreClient->eventManager.onMessageCreationEvent.functions.size() > 0) {
-											discordCoreClient->eventManager.onMessageCreationEvent(*dataPackage);
+										if (discordCoreClient->eventManager.onMessageCreationEvent.hasListeners() || MessageCollector::collectorRegistry.size() > 0) {
+											UniquePtr<OnMessageCreationData> dataPackage{ makeUnique<OnMessageCreationData>(parser, dataNew) };
+											if (discordCoreClient->eventManager.onMessageCreationEvent.hasListeners()) {
+												discordCoreClient->eventManager.onMessageCreationEvent(*dataPackage);
+											}
 										}
 										break;
 									}
 									case 45: {
-										UniquePtr<OnMessageUpdateData> dataPackage{ makeUnique<OnMessageUpdateData>(parser, dataNew) };
-										if (discordCoreClient->eventManager.onMessageUpdateEvent.functions.size() > 0) {
-											discordCoreClient->eventManager.onMessageUpdateEvent(*dataPackage);
+										if (discordCoreClient->eventManager.onMessageUpdateEvent.hasListeners() || MessageCollector::collectorRegistry.size() > 0) {
+											UniquePtr<OnMessageUpdateData> dataPackage{ makeUnique<OnMessageUpdateData>(parser, dataNew) };
+											if (discordCoreClient->eventManager.onMessageUpdateEvent.hasListeners()) {
+												discordCoreClient->eventManager.onMessageUpdateEvent(*dataPackage);
+											}
 										}
 										break;
 									}
 									case 46: {
-										if (discordCoreClient->eventManager.onMessageDeletionEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onMessageDeletionEvent.hasListeners()) {
 											UniquePtr<OnMessageDeletionData> dataPackage{ makeUnique<OnMessageDeletionData>(parser, dataNew) };
 											discordCoreClient->eventManager.onMessageDeletionEvent(*dataPackage);
 										}
 										break;
 									}
 									case 47: {
-										if (discordCoreClient->eventManager.onMessageDeleteBulkEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onMessageDeleteBulkEvent.hasListeners()) {
 											UniquePtr<OnMessageDeleteBulkData> dataPackage{ makeUnique<OnMessageDeleteBulkData>(parser, dataNew) };
 											discordCoreClient->eventManager.onMessageDeleteBulkEvent(*dataPackage);
 										}
 										break;
 									}
 									case 48: {
-										if (discordCoreClient->eventManager.onReactionAddEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onReactionAddEvent.hasListeners() || ReactionCollector::collectorRegistry.size() > 0) {
 											UniquePtr<OnReactionAddData> dataPackage{ makeUnique<OnReactionAddData>(parser, dataNew) };
-											discordCoreClient->eventManager.onReactionAddEvent(*dataPackage);
+											if (discordCoreClient->eventManager.onReactionAddEvent.hasListeners()) {
+												discordCoreClient->eventManager.onReactionAddEvent(*dataPackage);
+											}
 										}
 										break;
 									}
 									case 49: {
-										if (discordCoreClient->eventManager.onReactionRemoveEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onReactionRemoveEvent.hasListeners()) {
 											UniquePtr<OnReactionRemoveData> dataPackage{ makeUnique<OnReactionRemoveData>(parser, dataNew) };
 											discordCoreClient->eventManager.onReactionRemoveEvent(*dataPackage);
 										}
 										break;
 									}
 									case 50: {
-										if (discordCoreClient->eventManager.onReactionRemoveAllEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onReactionRemoveAllEvent.hasListeners()) {
 											UniquePtr<OnReactionRemoveAllData> dataPackage{ makeUnique<OnReactionRemoveAllData>(parser, dataNew) };
 											discordCoreClient->eventManager.onReactionRemoveAllEvent(*dataPackage);
 										}
 										break;
 									}
 									case 51: {
-										if (discordCoreClient->eventManager.onReactionRemoveEmojiEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onReactionRemoveEmojiEvent.hasListeners()) {
 											UniquePtr<OnReactionRemoveEmojiData> dataPackage{ makeUnique<OnReactionRemoveEmojiData>(parser,
 												dataNew) };
 											discordCoreClient->eventManager.onReactionRemoveEmojiEvent(*dataPackage);
@@ -921,14 +981,14 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 52: {
-										UniquePtr<OnPresenceUpdateData> dataPackage{ makeUnique<OnPresenceUpdateData>(parser, dataNew) };
-										if (discordCoreClient->eventManager.onPresenceUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onPresenceUpdateEvent.hasListeners()) {
+											UniquePtr<OnPresenceUpdateData> dataPackage{ makeUnique<OnPresenceUpdateData>(parser, dataNew) };
 											discordCoreClient->eventManager.onPresenceUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 53: {
-										if (discordCoreClient->eventManager.onStageInstanceCreationEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onStageInstanceCreationEvent.hasListeners()) {
 											UniquePtr<OnStageInstanceCreationData> dataPackage{ makeUnique<OnStageInstanceCreationData>(parser,
 												dataNew) };
 											discordCoreClient->eventManager.onStageInstanceCreationEvent(*dataPackage);
@@ -936,7 +996,7 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 54: {
-										if (discordCoreClient->eventManager.onStageInstanceUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onStageInstanceUpdateEvent.hasListeners()) {
 											UniquePtr<OnStageInstanceUpdateData> dataPackage{ makeUnique<OnStageInstanceUpdateData>(parser,
 												dataNew) };
 											discordCoreClient->eventManager.onStageInstanceUpdateEvent(*dataPackage);
@@ -944,7 +1004,7 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 55: {
-										if (discordCoreClient->eventManager.onStageInstanceDeletionEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onStageInstanceDeletionEvent.hasListeners()) {
 											UniquePtr<OnStageInstanceDeletionData> dataPackage{ makeUnique<OnStageInstanceDeletionData>(parser,
 												dataNew) };
 											discordCoreClient->eventManager.onStageInstanceDeletionEvent(*dataPackage);
@@ -952,14 +1012,14 @@ namespace DiscordCoreAPI {
 										break;
 									}
 									case 56: {
-										if (discordCoreClient->eventManager.onTypingStartEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onTypingStartEvent.hasListeners()) {
 											UniquePtr<OnTypingStartData> dataPackage{ makeUnique<OnTypingStartData>(parser, dataNew) };
 											discordCoreClient->eventManager.onTypingStartEvent(*dataPackage);
 										}
 										break;
 									}
 									case 57: {
-										if (discordCoreClient->eventManager.onUserUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onUserUpdateEvent.hasListeners()) {
 											UniquePtr<OnUserUpdateData> dataPackage{ makeUnique<OnUserUpdateData>(parser, dataNew) };
 											discordCoreClient->eventManager.onUserUpdateEvent(*dataPackage);
 										}
@@ -967,20 +1027,20 @@ namespace DiscordCoreAPI {
 									}
 									case 58: {
 										UniquePtr<OnVoiceStateUpdateData> dataPackage{ makeUnique<OnVoiceStateUpdateData>(parser, dataNew, this) };
-										if (discordCoreClient->eventManager.onVoiceStateUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onVoiceStateUpdateEvent.hasListeners()) {
 											discordCoreClient->eventManager.onVoiceStateUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 59: {
 										UniquePtr<OnVoiceServerUpdateData> dataPackage{ makeUnique<OnVoiceServerUpdateData>(parser, dataNew, this) };
-										if (discordCoreClient->eventManager.onVoiceServerUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onVoiceServerUpdateEvent.hasListeners()) {
 											discordCoreClient->eventManager.onVoiceServerUpdateEvent(*dataPackage);
 										}
 										break;
 									}
 									case 60: {
-										if (discordCoreClient->eventManager.onWebhookUpdateEvent.functions.size() > 0) {
+										if (discordCoreClient->eventManager.onWebhookUpdateEvent.hasListeners()) {
 											UniquePtr<OnWebhookUpdateData> dataPackage{ makeUnique<OnWebhookUpdateData>(parser, dataNew) };
 											discordCoreClient->eventManager.onWebhookUpdateEvent(*dataPackage);
 										}
@@ -1026,9 +1086,9 @@ namespace DiscordCoreAPI {
 							WebSocketMessageData<HelloData> data{};
 							parser.parseJson<true, true>(data, dataNew);
 							if (data.d.heartbeatInterval != 0) {
-								areWeHeartBeating = true;
 								heartBeatStopWatch = StopWatch<Milliseconds>{ Milliseconds{ data.d.heartbeatInterval } };
 								heartBeatStopWatch.resetTimer();
+								startHeartBeating(Milliseconds{ data.d.heartbeatInterval });
 								haveWeReceivedHeartbeatAck = true;
 							}
 							if (areWeResuming) {
@@ -1101,8 +1161,12 @@ namespace DiscordCoreAPI {
 				tcpConnection.writeData(dataNew, true);
 				tcpConnection.disconnect();
 				currentState.store(WebSocketState::Disconnected);
-				areWeHeartBeating = false;
 			}
+			stopHeartBeating();
+		}
+
+		WebSocketCore::~WebSocketCore() {
+			stopHeartBeating();
 		}
 
 		void WebSocketClient::disconnect() {
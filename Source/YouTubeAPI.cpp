@@ -201,7 +201,7 @@ namespace DiscordCoreAPI {
 		Jsonifier::Vector<Song> YouTubeRequestBuilder::collectSearchResults(const std::string& searchQuery) {
 			HttpsWorkloadData dataPackage{ HttpsWorkloadType::YouTubeGetSearchResults };
 			dataPackage.baseUrl = baseUrl;
-			dataPackage.relativePath = "/results?search_query=" + urlEncode(collectVideoIdFromSearchQuery(searchQuery).c_str());
+			dataPackage.setRelativePath("/results?search_query=", urlEncode(collectVideoIdFromSearchQuery(searchQuery).c_str()));
 			dataPackage.workloadClass = HttpsWorkloadClass::Get;
 			HttpsResponseData returnData = submitWorkloadAndGetResult(std::move(dataPackage));
 			if (returnData.responseCode != 200) {
@@ -328,21 +328,22 @@ namespace DiscordCoreAPI {
 			guildId = guildIdNew;
 		}
 
-		void YouTubeAPI::weFailedToDownloadOrDecode(const Song& songNew, NewThreadAwaiter<void, false> threadHandle, uint64_t currentRetries) {
+		void YouTubeAPI::weFailedToDownloadOrDecode(const Song& songNew, BoundedMessageBlock<AudioFrameData>& audioDataBuffer,
+			NewThreadAwaiter<void, false> threadHandle, uint64_t currentRetries) {
 			std::this_thread::sleep_for(1s);
 			++currentRetries;
 			if (currentRetries <= 10) {
-				downloadAndStreamAudio(songNew, threadHandle, currentRetries);
-			} else {
+				downloadAndStreamAudio(songNew, audioDataBuffer, threadHandle, currentRetries);
+			} else if (!DiscordCoreClient::getSongAPI(guildId).onPrefetchFailed(audioDataBuffer)) {
 				GuildMemberData guildMember{ GuildMembers::getCachedGuildMember({ .guildMemberId = songNew.addedByUserId, .guildId = guildId }) };
 				DiscordCoreClient::getSongAPI(guildId).skip(guildMember, true);
 			}
 		}
 
-		CoRoutine<void, false> YouTubeAPI::downloadAndStreamAudio(const Song songNew, NewThreadAwaiter<void, false> threadHandle,
-			uint64_t currentReconnectTries) {
+		CoRoutine<void, false> YouTubeAPI::downloadAndStreamAudio(const Song songNew, BoundedMessageBlock<AudioFrameData>& audioDataBuffer,
+			NewThreadAwaiter<void, false> threadHandle, uint64_t currentReconnectTries) {
+			WorkingScope workingScope{ *this };
 			try {
-				areWeWorkingBool.store(true);
 				std::coroutine_handle<CoRoutine<void, false>::promise_type> coroHandle{};
 				if (currentReconnectTries == 0) {
 					threadHandle = NewThreadAwaitable<void, false>();
@@ -361,8 +362,7 @@ namespace DiscordCoreAPI {
 								songNew.finalDownloadUrls[0].urlPath.substr(0, songNew.finalDownloadUrls[0].urlPath.find(".com") + 4);
 						}
 					} else {
-						weFailedToDownloadOrDecode(songNew, threadHandle, currentReconnectTries);
-						areWeWorkingBool.store(false);
+						weFailedToDownloadOrDecode(songNew, audioDataBuffer, threadHandle, currentReconnectTries);
 						co_return;
 					}
 					workloadData.workloadClass = HttpsWorkloadClass::Get;
@@ -370,63 +370,92 @@ namespace DiscordCoreAPI {
 					workloadData.headersToInsert["Connection"] = "Keep-Alive";
 					workloadData.headersToInsert["Host"] = songNew.finalDownloadUrls[0].urlPath;
 					workloadData.headersToInsert["Origin"] = "https://music.youtube.com";
-					workloadData.relativePath =
-						songNew.finalDownloadUrls[1].urlPath + "&range=" + std::to_string(currentStart) + "-" + std::to_string(currentEnd);
+					workloadData.setRelativePath(songNew.finalDownloadUrls[1].urlPath, "&range=", currentStart, "-", currentEnd);
 					workloadVector.emplace_back(std::move(workloadData));
-					currentStart = currentEnd;
+					currentStart = currentEnd + 1;
 					currentEnd += x == intervalCount - 2 ? remainder : (1024ull * 1024ull);
 				}
-				std::basic_string<uint8_t> buffer{};
 				MatroskaDemuxer demuxer{};
+				auto doWeStop = [&] {
+					return coroHandle.promise().areWeStopped();
+				};
+				coroHandle.promise().setStopCallback([buffer = &audioDataBuffer] {
+					buffer->wakeSenders();
+				});
+				AudioFrameData frameData{};
+				UniquePtr<AudioCacheWriter> cacheWriter{};
+				if (auto audioCache = DiscordCoreClient::getInstance()->getAudioCache(); audioCache) {
+					cacheWriter = makeUnique<AudioCacheWriter>(audioCache->createWriter(songNew));
+				}
 				uint64_t index{};
-				while (index < intervalCount || !demuxer.areWeDone()) {
-					if (index < intervalCount) {
-						HttpsResponseData result{ submitWorkloadAndGetResult(std::move(workloadVector[index])) };
-						if (result.responseCode != 200) {
-							areWeWorkingBool.store(false);
-							weFailedToDownloadOrDecode(songNew, threadHandle, currentReconnectTries);
-							co_return;
-						}
-						if (result.responseData.size() > 0) {
-							++index;
-							auto oldSize = buffer.size();
-							buffer.resize(buffer.size() + result.responseData.size());
-							std::memcpy(buffer.data() + oldSize, result.responseData.data(), result.responseData.size());
-							demuxer.writeData({ buffer.data(), buffer.size() });
-							demuxer.proceedDemuxing();
-						}
+				while (index < intervalCount && !demuxer.areWeDone()) {
+					HttpsResponseData result{ submitWorkloadAndGetResult(std::move(workloadVector[index])) };
+					if (result.responseCode != 200) {
+						weFailedToDownloadOrDecode(songNew, audioDataBuffer, threadHandle, currentReconnectTries);
+						co_return;
+					}
+					if (result.responseData.size() > 0) {
+						++index;
+						demuxer.writeData(
+							{ reinterpret_cast<const uint8_t*>(result.responseData.data()), static_cast<uint64_t>(result.responseData.size()) });
+						demuxer.proceedDemuxing();
 					}
 					bool didWeReceive{ true };
 					do {
-						AudioFrameData frameData{};
+						frameData.clearData();
 						didWeReceive = demuxer.collectFrame(frameData);
 						if (coroHandle.promise().areWeStopped()) {
-							areWeWorkingBool.store(false);
 							co_return;
 						}
 						if (frameData.currentSize != 0) {
 							frameData.guildMemberId = songNew.addedByUserId.operator const uint64_t&();
-							DiscordCoreClient::getSongAPI(guildId).audioDataBuffer.send(std::move(frameData));
+							if (cacheWriter) {
+								cacheWriter->writeFrame({ frameData.data.data(), static_cast<uint64_t>(frameData.currentSize) });
+							}
+							if (!audioDataBuffer.send(frameData, doWeStop)) {
+								co_return;
+							}
 						}
 					} while (didWeReceive);
 					std::this_thread::sleep_for(1ms);
 				}
-				areWeWorkingBool.store(false);
-				DiscordCoreClient::getVoiceConnection(guildId).skip(false);
-				AudioFrameData frameData{};
+				if (cacheWriter) {
+					cacheWriter->finalize();
+				}
+				DiscordCoreClient::getSongAPI(guildId).onDownloadComplete(audioDataBuffer);
+				frameData.clearData();
 				frameData.guildMemberId = songNew.addedByUserId.operator const uint64_t&();
-				DiscordCoreClient::getSongAPI(guildId).audioDataBuffer.send(std::move(frameData));
+				audioDataBuffer.send(frameData, doWeStop);
 				co_return;
 			} catch (const HttpsError& error) {
 				MessagePrinter::printError<PrintMessageType::Https>("YouTubeAPI::downloadAndStreamAudio() Error: " + std::string{ error.what() });
-				weFailedToDownloadOrDecode(songNew, threadHandle, currentReconnectTries);
-				areWeWorkingBool.store(false);
+				weFailedToDownloadOrDecode(songNew, audioDataBuffer, threadHandle, currentReconnectTries);
 			}
 			co_return;
 		}
 
+		YouTubeAPI::WorkingScope::WorkingScope(YouTubeAPI& apiNew) : api{ apiNew } {
+			std::unique_lock lock{ api.workingMutex };
+			++api.workingCount;
+		}
+
+		YouTubeAPI::WorkingScope::~WorkingScope() {
+			std::unique_lock lock{ api.workingMutex };
+			if (--api.workingCount == 0) {
+				api.workingCondition.notify_all();
+			}
+		}
+
 		bool YouTubeAPI::areWeWorking() {
-			return areWeWorkingBool.load();
+			std::unique_lock lock{ workingMutex };
+			return workingCount > 0;
+		}
+
+		bool YouTubeAPI::waitForIdle(HRClock::time_point deadline) {
+			std::unique_lock lock{ workingMutex };
+			return workingCondition.wait_until(lock, deadline, [&] {
+				return workingCount == 0;
+			});
 		}
 
 		Jsonifier::Vector<Song> YouTubeAPI::searchForSong(const std::string& searchQuery) {
@@ -0,0 +1,86 @@
+// AudioDemuxerHarness.cpp - Streams the Ogg and WAV fixtures through OggDemuxer and WavDemuxer, and counts the frames that come out.
+// Oct 18, 2026
+// Chris M.
+// https://github.com/RealTimeChris
+
+#include <discordcoreapi/Index.hpp>
+#include <filesystem>
+#include <iostream>
+
+using namespace DiscordCoreAPI;
+using namespace DiscordCoreAPI::DiscordCoreInternal;
+
+/// @brief The frames that a fixture yielded - their count, and their combined size.
+struct FrameTally {
+	uint64_t frameCount{};
+	uint64_t byteCount{};
+};
+
+static std::string readFile(const std::string& fileName) {
+	std::ifstream file{ std::filesystem::path{ CORPUS_DIRECTORY } / "Audio" / fileName, std::ios::binary };
+	return std::string{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+}
+
+/// @brief Streams the file through an OggDemuxer the way SongAPI does - in chunks of at least targetChunkSize bytes, each ending at a page
+/// boundary.
+static FrameTally streamOgg(std::string_view fileData, uint64_t targetChunkSize) {
+	static constexpr std::string_view capturePattern{ "OggS" };
+	OggDemuxer demuxer{};
+	AudioFrameData frameData{};
+	FrameTally tally{};
+	uint64_t currentPosition{ fileData.find(capturePattern) };
+	while (currentPosition < fileData.size()) {
+		uint64_t nextPosition{ fileData.find(capturePattern, std::min(currentPosition + targetChunkSize, fileData.size())) };
+		nextPosition = std::min(nextPosition, fileData.size());
+		demuxer.writeData(fileData.substr(currentPosition, nextPosition - currentPosition));
+		demuxer.proceedDemuxing();
+		currentPosition = nextPosition;
+		frameData.clearData();
+		while (demuxer.collectFrame(frameData)) {
+			if (frameData.type != AudioFrameType::Encoded) {
+				std::cout << "OggDemuxer yielded a frame that was not marked as encoded." << std::endl;
+				std::exit(EXIT_FAILURE);
+			}
+			++tally.frameCount;
+			tally.byteCount += static_cast<uint64_t>(frameData.currentSize);
+			frameData.clearData();
+		}
+	}
+	return tally;
+}
+
+/// @brief Streams the file through a WavDemuxer, checking that every frame is a full 20ms of 48kHz stereo PCM.
+static FrameTally streamWav(std::string_view fileData) {
+	WavDemuxer demuxer{};
+	AudioFrameData frameData{};
+	FrameTally tally{};
+	if (!demuxer.openWav({ reinterpret_cast<const uint8_t*>(fileData.data()), fileData.size() })) {
+		return tally;
+	}
+	while (demuxer.collectFrame(frameData)) {
+		if (frameData.type != AudioFrameType::RawPCM || static_cast<uint64_t>(frameData.currentSize) != WavDemuxer::bytesPerFrame) {
+			std::cout << "WavDemuxer yielded a frame that was not 20ms of PCM." << std::endl;
+			std::exit(EXIT_FAILURE);
+		}
+		++tally.frameCount;
+		tally.byteCount += static_cast<uint64_t>(frameData.currentSize);
+		frameData.clearData();
+	}
+	return tally;
+}
+
+static bool checkTally(std::string_view name, FrameTally tally, uint64_t expectedFrameCount, uint64_t expectedByteCount) {
+	std::cout << name << ": " << tally.frameCount << " frames, " << tally.byteCount << " bytes." << std::endl;
+	return tally.frameCount == expectedFrameCount && tally.byteCount == expectedByteCount;
+}
+
+int32_t main() {
+	// The Ogg fixture holds an OpusHead page, an OpusTags page, and 100 Opus packets over four pages - 18950 bytes of them, some of which
+	// span two lacing values. The WAV fixtures hold 10.5 frames of stereo, behind an odd-sized LIST chunk, and 5 frames of mono.
+	std::string oggData{ readFile("opus_100_frames.ogg") };
+	bool didWePass{ checkTally("opus_100_frames.ogg, one page per write", streamOgg(oggData, 1), 100, 18950) };
+	didWePass = checkTally("opus_100_frames.ogg, in a single write", streamOgg(oggData, oggData.size()), 100, 18950) && didWePass;
+	didWePass = checkTally("stereo_11_frames.wav", streamWav(readFile("stereo_11_frames.wav")), 11, 11 * WavDemuxer::bytesPerFrame) && didWePass;
+	didWePass = checkTally("mono_5_frames.wav", streamWav(readFile("mono_5_frames.wav")), 5, 5 * WavDemuxer::bytesPerFrame) && didWePass;
+	return didWePass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
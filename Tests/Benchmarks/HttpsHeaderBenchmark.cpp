@@ -0,0 +1,67 @@
+// HttpsHeaderBenchmark.cpp - Times the parsing of a REST response's headers.
+// Oct 18, 2026
+// Chris M.
+// https://github.com/RealTimeChris
+
+#include <discordcoreapi/Index.hpp>
+#include <iostream>
+
+using namespace DiscordCoreAPI;
+using namespace DiscordCoreAPI::DiscordCoreInternal;
+
+// The headers of a typical rate-limited Discord response, followed by a small body.
+static const std::string responseHeaders{
+	"HTTP/1.1 200 OK\r\n"
+	"Date: Sun, 18 Oct 2026 10:00:00 GMT\r\n"
+	"Content-Type: application/json\r\n"
+	"Content-Length: 2\r\n"
+	"Connection: keep-alive\r\n"
+	"set-cookie: __dcfduid=0123456789abcdef0123456789abcdef; Expires=Fri, 17-Oct-2031 10:00:00 GMT; Max-Age=157680000; "
+	"Secure; HttpOnly; Path=/; SameSite=Lax\r\n"
+	"strict-transport-security: max-age=31536000; includeSubDomains; preload\r\n"
+	"x-ratelimit-bucket: 80c17d2f203122d936070c88c8d10f33\r\n"
+	"x-ratelimit-limit: 5\r\n"
+	"x-ratelimit-remaining: 4\r\n"
+	"x-ratelimit-reset: 1792317601.000\r\n"
+	"x-ratelimit-reset-after: 1.000\r\n"
+	"via: 1.1 google\r\n"
+	"alt-svc: h3=\":443\"; ma=86400\r\n"
+	"CF-Cache-Status: DYNAMIC\r\n"
+	"Report-To: {\"endpoints\":[{\"url\":\"https://a.nel.cloudflare.com/report/v3\"}],\"group\":\"cf-nel\",\"max_age\":604800}\r\n"
+	"NEL: {\"success_fraction\":0,\"report_to\":\"cf-nel\",\"max_age\":604800}\r\n"
+	"X-Content-Type-Options: nosniff\r\n"
+	"Server: cloudflare\r\n"
+	"CF-RAY: 80c17d2f2031-LHR\r\n"
+	"\r\n"
+	"{}"
+};
+
+static constexpr uint64_t iterationCount{ 1000000 };
+
+/// @brief Parses the response's headers iterationCount times, returning the mean time per parse.
+static double timeParse(HttpsConnection& connection) {
+	auto startTime = std::chrono::high_resolution_clock::now();
+	for (uint64_t x = 0; x < iterationCount; ++x) {
+		connection.inputBufferReal = responseHeaders;
+		connection.data = HttpsResponseData{};
+		if (!connection.parseHeaders() || connection.data.responseCode != 200) {
+			std::cout << "The headers failed to parse." << std::endl;
+			std::exit(EXIT_FAILURE);
+		}
+	}
+	std::chrono::duration<double, std::nano> totalTime{ std::chrono::high_resolution_clock::now() - startTime };
+	return totalTime.count() / static_cast<double>(iterationCount);
+}
+
+int32_t main() {
+	HttpsConnection connection{};
+	std::cout << "Headers collected: none - " << timeParse(connection) << "ns per response." << std::endl;
+	connection.workload.headersToCollect.emplace_back("x-ratelimit-limit");
+	connection.workload.headersToCollect.emplace_back("cf-ray");
+	std::cout << "Headers collected: 2 - " << timeParse(connection) << "ns per response." << std::endl;
+	if (connection.data.responseHeaders.size() != 2 || connection.data.responseHeaders["cf-ray"] != "80c17d2f2031-LHR") {
+		std::cout << "The collected headers were wrong." << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
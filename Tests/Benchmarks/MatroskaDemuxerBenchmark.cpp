@@ -0,0 +1,81 @@
+// MatroskaDemuxerBenchmark.cpp - Times MatroskaDemuxer over a synthetic WebM/Opus stream, written in chunks of several sizes.
+// Oct 18, 2026
+// Chris M.
+// https://github.com/RealTimeChris
+
+#include <discordcoreapi/Index.hpp>
+#include <iostream>
+
+using namespace DiscordCoreAPI;
+using namespace DiscordCoreAPI::DiscordCoreInternal;
+
+static constexpr uint64_t clusterCount{ 20000 };
+static constexpr uint64_t framesPerCluster{ 50 };
+static constexpr uint64_t frameSize{ 160 };
+
+/// @brief Appends an EBML element whose size is written as an 8-byte vint, or as the unknown size.
+static void appendElement(std::basic_string<uint8_t>& stream, uint32_t elementId, std::basic_string_view<uint8_t> payload,
+	bool isSizeUnknown = false) {
+	for (int32_t shift = 24; shift >= 0; shift -= 8) {
+		if ((elementId >> shift) != 0) {
+			stream.push_back(static_cast<uint8_t>(elementId >> shift));
+		}
+	}
+	stream.push_back(0x01);
+	for (int32_t shift = 48; shift >= 0; shift -= 8) {
+		stream.push_back(isSizeUnknown ? 0xFF : static_cast<uint8_t>(payload.size() >> shift));
+	}
+	stream.append(payload);
+}
+
+/// @brief Builds an EBML header, then an unknown-size Segment holding one Opus track, and clusterCount Clusters of SimpleBlocks.
+static std::basic_string<uint8_t> buildStream() {
+	std::basic_string<uint8_t> stream{}, element{}, trackEntry{}, cluster{};
+	appendElement(element, 0x4282, reinterpret_cast<const uint8_t*>("webm"));
+	appendElement(stream, 0x1A45DFA3, element);
+	appendElement(stream, SEGMENT_ID, {}, true);
+	appendElement(trackEntry, TRACK_NUMBER_ID, std::basic_string_view<uint8_t>{ reinterpret_cast<const uint8_t*>("\x01"), 1 });
+	appendElement(trackEntry, CODEC_ID, reinterpret_cast<const uint8_t*>("A_OPUS"));
+	element.clear();
+	appendElement(element, TRACK_ENTRY_ID, trackEntry);
+	appendElement(stream, TRACKS_ID, element);
+	std::basic_string<uint8_t> block{ 0x81, 0x00, 0x00, 0x80 };
+	block.resize(block.size() + frameSize, 0xFC);
+	for (uint64_t x = 0; x < framesPerCluster; ++x) {
+		appendElement(cluster, SIMPLEBLOCK_ID, block);
+	}
+	for (uint64_t x = 0; x < clusterCount; ++x) {
+		appendElement(stream, CLUSTER_ID, cluster);
+	}
+	return stream;
+}
+
+/// @brief Demuxes the stream in chunks of the given size, returning the throughput in MiB/s.
+static double timeDemuxing(std::basic_string_view<uint8_t> stream, uint64_t chunkSize) {
+	MatroskaDemuxer demuxer{};
+	std::basic_string_view<uint8_t> frame{};
+	uint64_t frameCount{};
+	auto startTime = std::chrono::high_resolution_clock::now();
+	for (uint64_t x = 0; x < stream.size(); x += chunkSize) {
+		demuxer.writeData(stream.substr(x, chunkSize));
+		demuxer.proceedDemuxing();
+		while (demuxer.collectFrame(frame)) {
+			++frameCount;
+		}
+	}
+	std::chrono::duration<double> totalTime{ std::chrono::high_resolution_clock::now() - startTime };
+	if (frameCount != clusterCount * framesPerCluster) {
+		std::cout << "Demuxed " << frameCount << " frames, rather than " << clusterCount * framesPerCluster << "." << std::endl;
+		std::exit(EXIT_FAILURE);
+	}
+	return static_cast<double>(stream.size()) / (1024.0 * 1024.0) / totalTime.count();
+}
+
+int32_t main() {
+	std::basic_string<uint8_t> stream{ buildStream() };
+	std::cout << "Stream: " << stream.size() / (1024 * 1024) << "MiB, " << clusterCount * framesPerCluster << " frames." << std::endl;
+	for (uint64_t chunkSize: { 1024ull, 16ull * 1024ull, 1024ull * 1024ull }) {
+		std::cout << "Chunk size: " << chunkSize << " bytes - " << timeDemuxing(stream, chunkSize) << "MiB/s." << std::endl;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,97 @@
+// MatroskaFuzzDriver.cpp - Feeds the Matroska corpus through MatroskaDemuxer, split at random points, and checks that every split yields the
+// same frames as a single write.
+// Oct 18, 2026
+// Chris M.
+// https://github.com/RealTimeChris
+
+#include <discordcoreapi/Index.hpp>
+#include <filesystem>
+#include <iostream>
+#include <random>
+
+using namespace DiscordCoreAPI;
+using namespace DiscordCoreAPI::DiscordCoreInternal;
+
+using FrameList = std::vector<std::basic_string<uint8_t>>;
+
+static constexpr uint64_t iterationsPerFile{ 2000 };
+static constexpr uint64_t maxSplitCount{ 32 };
+
+// The number of frames that each of the valid files must yield - the truncated and malformed ones need only not crash, and agree with
+// themselves across splits.
+static const std::unordered_map<std::string, uint64_t> expectedFrameCounts{ { "valid_simple_blocks.webm", 50 },
+	{ "valid_laced_unknown_sizes.webm", 11 }, { "valid_second_track.webm", 2 } };
+
+/// @brief Writes the file to a fresh demuxer in pieces, ending each piece at the next split point, and collects every frame.
+static FrameList demux(std::basic_string_view<uint8_t> fileData, const std::vector<uint64_t>& splitPoints) {
+	MatroskaDemuxer demuxer{};
+	FrameList frames{};
+	std::basic_string_view<uint8_t> frame{};
+	uint64_t currentPosition{};
+	for (uint64_t splitPoint: splitPoints) {
+		demuxer.writeData(fileData.substr(currentPosition, splitPoint - currentPosition));
+		demuxer.proceedDemuxing();
+		while (demuxer.collectFrame(frame)) {
+			frames.emplace_back(frame);
+		}
+		currentPosition = splitPoint;
+	}
+	return frames;
+}
+
+/// @brief Draws between one and maxSplitCount sorted split points, the last of which is always the end of the file.
+static std::vector<uint64_t> drawSplitPoints(std::mt19937_64& randomEngine, uint64_t fileSize) {
+	std::vector<uint64_t> splitPoints{};
+	uint64_t splitCount{ std::uniform_int_distribution<uint64_t>{ 0, maxSplitCount - 1 }(randomEngine) };
+	for (uint64_t x = 0; x < splitCount; ++x) {
+		splitPoints.emplace_back(std::uniform_int_distribution<uint64_t>{ 0, fileSize }(randomEngine));
+	}
+	splitPoints.emplace_back(fileSize);
+	std::sort(splitPoints.begin(), splitPoints.end());
+	return splitPoints;
+}
+
+int32_t main(int32_t argc, char* argv[]) {
+	uint64_t seed{ argc > 1 ? std::stoull(argv[1]) : 0x5EED };
+	std::mt19937_64 randomEngine{ seed };
+	std::vector<std::filesystem::path> filePaths{};
+	for (auto& entry: std::filesystem::directory_iterator{ std::filesystem::path{ CORPUS_DIRECTORY } / "Matroska" }) {
+		filePaths.emplace_back(entry.path());
+	}
+	std::sort(filePaths.begin(), filePaths.end());
+	bool didWeFail{};
+	for (auto& filePath: filePaths) {
+		std::ifstream file{ filePath, std::ios::binary };
+		std::string fileContents{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+		std::basic_string_view<uint8_t> fileData{ reinterpret_cast<const uint8_t*>(fileContents.data()), fileContents.size() };
+		std::string fileName{ filePath.filename().string() };
+		FrameList expectedFrames{ demux(fileData, { fileData.size() }) };
+		if (expectedFrameCounts.contains(fileName) && expectedFrames.size() != expectedFrameCounts.at(fileName)) {
+			std::cout << fileName << ": yielded " << expectedFrames.size() << " frames in a single write, rather than "
+					  << expectedFrameCounts.at(fileName) << "." << std::endl;
+			didWeFail = true;
+		}
+		std::vector<uint64_t> everyByte{};
+		for (uint64_t x = 1; x <= fileData.size(); ++x) {
+			everyByte.emplace_back(x);
+		}
+		if (demux(fileData, everyByte) != expectedFrames) {
+			std::cout << fileName << ": yielded different frames when written one byte at a time." << std::endl;
+			didWeFail = true;
+		}
+		for (uint64_t x = 0; x < iterationsPerFile; ++x) {
+			auto splitPoints = drawSplitPoints(randomEngine, fileData.size());
+			if (demux(fileData, splitPoints) != expectedFrames) {
+				std::cout << fileName << ": yielded different frames when split at:";
+				for (uint64_t splitPoint: splitPoints) {
+					std::cout << " " << splitPoint;
+				}
+				std::cout << ", with seed: " << seed << "." << std::endl;
+				didWeFail = true;
+				break;
+			}
+		}
+		std::cout << fileName << ": " << expectedFrames.size() << " frames." << std::endl;
+	}
+	return didWeFail ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,55 @@
+// QueueContentionBenchmark.cpp - Times MPMCQueue against UnboundedMessageBlock, with several producers and consumers contending.
+// Oct 18, 2026
+// Chris M.
+// https://github.com/RealTimeChris
+
+#include <discordcoreapi/Index.hpp>
+#include <iostream>
+
+using namespace DiscordCoreAPI;
+
+static constexpr uint64_t objectsPerProducer{ 1000000 };
+
+/// @brief Pushes objectsPerProducer objects through the queue from each producer, returning the mean time per object.
+template<typename QueueType> static double timeContention(QueueType& queue, uint64_t producerCount, uint64_t consumerCount) {
+	uint64_t totalCount{ objectsPerProducer * producerCount };
+	std::atomic_uint64_t receivedCount{};
+	std::atomic_uint64_t receivedSum{};
+	Jsonifier::Vector<std::jthread> threads{};
+	auto startTime = std::chrono::high_resolution_clock::now();
+	for (uint64_t x = 0; x < consumerCount; ++x) {
+		threads.emplace_back([&]() {
+			uint64_t object{};
+			while (receivedCount.load(std::memory_order_relaxed) < totalCount) {
+				if (queue.receiveFor(object, 1ms)) {
+					receivedSum.fetch_add(object, std::memory_order_relaxed);
+					receivedCount.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		});
+	}
+	for (uint64_t x = 0; x < producerCount; ++x) {
+		threads.emplace_back([&]() {
+			for (uint64_t y = 1; y <= objectsPerProducer; ++y) {
+				queue.send(y);
+			}
+		});
+	}
+	threads.clear();
+	std::chrono::duration<double, std::nano> totalTime{ std::chrono::high_resolution_clock::now() - startTime };
+	if (receivedSum.load() != producerCount * objectsPerProducer * (objectsPerProducer + 1) / 2) {
+		std::cout << "Objects were lost or duplicated." << std::endl;
+		std::exit(EXIT_FAILURE);
+	}
+	return totalTime.count() / static_cast<double>(totalCount);
+}
+
+int32_t main() {
+	for (uint64_t threadCount: { 1ull, 2ull, 4ull, 8ull }) {
+		MPMCQueue<uint64_t> mpmcQueue{ 1024 };
+		UnboundedMessageBlock<uint64_t> messageBlock{};
+		std::cout << "Producers/consumers: " << threadCount << " - MPMCQueue: " << timeContention(mpmcQueue, threadCount, threadCount)
+				  << "ns, UnboundedMessageBlock: " << timeContention(messageBlock, threadCount, threadCount) << "ns per object." << std::endl;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,139 @@
+// TlsResumptionHarness.cpp - Connects to a local TLS server repeatedly, and checks that every connection after the first resumes a session.
+// Oct 18, 2026
+// Chris M.
+// https://github.com/RealTimeChris
+
+#include <discordcoreapi/Index.hpp>
+#include <openssl/x509.h>
+#include <openssl/evp.h>
+#include <iostream>
+
+using namespace DiscordCoreAPI;
+using namespace DiscordCoreAPI::DiscordCoreInternal;
+
+static constexpr uint64_t connectionsPerRound{ 8 };
+static constexpr std::string_view greeting{ "ready" };
+
+/// @brief A client connection that only waits for the server's greeting - reading it also collects the session tickets sent before it.
+class ResumptionTestConnection : public TCPConnection<ResumptionTestConnection>, public SSLDataInterface<ResumptionTestConnection> {
+  public:
+	bool wasGreetingReceived{};
+
+	ResumptionTestConnection(const std::string& baseUrlNew, const uint16_t portNew)
+		: TCPConnection<ResumptionTestConnection>{ baseUrlNew, portNew } {};
+
+	void handleBuffer() {
+		wasGreetingReceived = true;
+	}
+};
+
+/// @brief A TLS server on the loopback interface, with a throwaway self-signed certificate, that greets each client and then closes.
+class LocalTlsServer {
+  public:
+	LocalTlsServer() {
+		EVP_PKEY* key{ EVP_EC_gen("P-256") };
+		X509* certificate{ X509_new() };
+		ASN1_INTEGER_set(X509_get_serialNumber(certificate), 1);
+		X509_gmtime_adj(X509_getm_notBefore(certificate), 0);
+		X509_gmtime_adj(X509_getm_notAfter(certificate), 60 * 60);
+		X509_set_pubkey(certificate, key);
+		X509_NAME_add_entry_by_txt(X509_get_subject_name(certificate), "CN", MBSTRING_ASC, reinterpret_cast<const uint8_t*>("localhost"), -1, -1, 0);
+		X509_set_issuer_name(certificate, X509_get_subject_name(certificate));
+		X509_sign(certificate, key, EVP_sha256());
+		context = SSL_CTX_new(TLS_server_method());
+		SSL_CTX_use_certificate(context, certificate);
+		SSL_CTX_use_PrivateKey(context, key);
+		X509_free(certificate);
+		EVP_PKEY_free(key);
+		listenSocket = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+		sockaddr_in address{};
+		address.sin_family = AF_INET;
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		socklen_t addressLength{ sizeof(address) };
+		if (::bind(listenSocket, reinterpret_cast<sockaddr*>(&address), addressLength) != 0 || ::listen(listenSocket, SOMAXCONN) != 0 ||
+			::getsockname(listenSocket, reinterpret_cast<sockaddr*>(&address), &addressLength) != 0) {
+			std::cout << "The local server failed to listen." << std::endl;
+			std::exit(EXIT_FAILURE);
+		}
+		port = ntohs(address.sin_port);
+		thread = std::jthread{ [this]() {
+			run();
+		} };
+	}
+
+	/// @brief Caps the TLS version of the connections that are accepted from here on.
+	void setMaxVersion(int32_t version) {
+		SSL_CTX_set_max_proto_version(context, version);
+	}
+
+	uint16_t getPort() {
+		return port;
+	}
+
+	~LocalTlsServer() {
+		::shutdown(listenSocket, SHUT_RDWR);
+		close(listenSocket);
+		thread.join();
+		SSL_CTX_free(context);
+	}
+
+  protected:
+	SOCKET listenSocket{};
+	SSL_CTX* context{};
+	std::jthread thread{};
+	uint16_t port{};
+
+	void run() {
+		while (true) {
+			SOCKET clientSocket{ ::accept(listenSocket, nullptr, nullptr) };
+			if (clientSocket == INVALID_SOCKET) {
+				return;
+			}
+			SSL* ssl{ SSL_new(context) };
+			SSL_set_fd(ssl, static_cast<int32_t>(clientSocket));
+			if (SSL_accept(ssl) == 1) {
+				SSL_write(ssl, greeting.data(), static_cast<int32_t>(greeting.size()));
+				char buffer[16]{};
+				SSL_read(ssl, buffer, sizeof(buffer));
+			}
+			SSL_free(ssl);
+			close(clientSocket);
+		}
+	}
+};
+
+/// @brief Connects connectionsPerRound times, and checks that only the first connection needed a full handshake.
+static bool runRound(LocalTlsServer& server, std::string_view roundName) {
+	TlsHandshakeStats statsBefore{ DiscordCoreClient::getTlsHandshakeStats() };
+	for (uint64_t x = 0; x < connectionsPerRound; ++x) {
+		ResumptionTestConnection connection{ "localhost", server.getPort() };
+		for (uint64_t y = 0; y < 100 && connection.currentStatus == ConnectionStatus::NO_Error && !connection.wasGreetingReceived; ++y) {
+			connection.processIO(50);
+		}
+		if (!connection.wasGreetingReceived) {
+			std::cout << roundName << ": connection " << x << " was never greeted." << std::endl;
+			return false;
+		}
+		connection.disconnect();
+	}
+	TlsHandshakeStats statsAfter{ DiscordCoreClient::getTlsHandshakeStats() };
+	uint64_t fullCount{ statsAfter.fullHandshakeCount - statsBefore.fullHandshakeCount };
+	uint64_t resumedCount{ statsAfter.resumedHandshakeCount - statsBefore.resumedHandshakeCount };
+	std::cout << roundName << ": " << fullCount << " full handshakes, " << resumedCount << " resumed." << std::endl;
+	return fullCount == 1 && resumedCount == connectionsPerRound - 1;
+}
+
+int32_t main() {
+#ifdef _WIN32
+	WSADataWrapper theWSAData{};
+#endif
+	if (!SSLContextHolder::initialize()) {
+		std::cout << "The client's SSL context failed to initialize." << std::endl;
+		return EXIT_FAILURE;
+	}
+	LocalTlsServer server{};
+	bool didWePass{ runRound(server, "TLS 1.3") };
+	server.setMaxVersion(TLS1_2_VERSION);
+	didWePass = runRound(server, "TLS 1.2") && didWePass;
+	return didWePass ? EXIT_SUCCESS : EXIT_FAILURE;
+}